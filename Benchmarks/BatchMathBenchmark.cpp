@@ -0,0 +1,318 @@
+/* ======================================================================== */
+/*!
+ * \file            BatchMathBenchmark.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Checks the batch math functions against the C math library, then times
+   the scalar and SSE2 array versions next to plain C library loops.
+
+   The accuracy check asserts the error bounds documented in BatchMath.hpp
+   and that the SSE2 versions match the scalar ones bit for bit. If any
+   check fails, the program prints what failed and returns 1 without
+   timing anything.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "Math/Batch/BatchMath.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Barrage;
+
+namespace
+{
+  const unsigned NUM_VALUES = 4096;
+  const unsigned NUM_CHECK_VALUES = 1 << 20;
+  const unsigned NUM_PASSES = 200;
+
+  const double TWO_PI = 6.283185307179586;
+
+  using SinCosFunction = void (*)(const float*, float*, float*, unsigned);
+  using Atan2Function = void (*)(const float*, const float*, float*, unsigned);
+  using WrapAnglesFunction = void (*)(float*, unsigned);
+  using LengthFunction = void (*)(const float*, const float*, float*, unsigned);
+
+  //! Tracks the largest error seen by a check and whether it stayed in bounds
+  struct Check
+  {
+    const char* name_;
+    double bound_;
+    double maxError_;
+    bool sameAsScalar_;
+  };
+
+  void LibmSinCos(const float* angles, float* sines, float* cosines, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      sines[i] = std::sin(angles[i]);
+      cosines[i] = std::cos(angles[i]);
+    }
+  }
+
+  void LibmAtan2(const float* ys, const float* xs, float* angles, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      angles[i] = std::atan2(ys[i], xs[i]);
+    }
+  }
+
+  void LibmWrapAngles(float* angles, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      float wrapped = std::fmod(angles[i], MathConstants::TWO_PI);
+
+      angles[i] = wrapped < 0.0f ? wrapped + MathConstants::TWO_PI : wrapped;
+    }
+  }
+
+  void LibmLength(const float* xs, const float* ys, float* lengths, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      lengths[i] = std::hypot(xs[i], ys[i]);
+    }
+  }
+
+  std::vector<float> RandomValues(std::mt19937& rng, float min, float max, unsigned count)
+  {
+    std::uniform_real_distribution<float> distribution(min, max);
+    std::vector<float> values(count);
+
+    for (auto it = values.begin(); it != values.end(); ++it)
+    {
+      *it = distribution(rng);
+    }
+
+    return values;
+  }
+
+  bool SameBits(const std::vector<float>& a, const std::vector<float>& b)
+  {
+    return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+  }
+
+  Check CheckSinCos(std::mt19937& rng, const char* name, float range, double bound)
+  {
+    Check check = { name, bound, 0.0, true };
+    std::vector<float> angles = RandomValues(rng, -range, range, NUM_CHECK_VALUES);
+    std::vector<float> sines(NUM_CHECK_VALUES), cosines(NUM_CHECK_VALUES);
+    std::vector<float> sse_sines(NUM_CHECK_VALUES), sse_cosines(NUM_CHECK_VALUES);
+
+    SinCosScalar(angles.data(), sines.data(), cosines.data(), NUM_CHECK_VALUES);
+    SinCosSSE2(angles.data(), sse_sines.data(), sse_cosines.data(), NUM_CHECK_VALUES);
+
+    for (unsigned i = 0; i < NUM_CHECK_VALUES; ++i)
+    {
+      double angle = angles[i];
+
+      check.maxError_ = std::max(check.maxError_, std::abs(sines[i] - std::sin(angle)));
+      check.maxError_ = std::max(check.maxError_, std::abs(cosines[i] - std::cos(angle)));
+    }
+
+    check.sameAsScalar_ = SameBits(sines, sse_sines) && SameBits(cosines, sse_cosines);
+
+    return check;
+  }
+
+  Check CheckAtan2(std::mt19937& rng)
+  {
+    Check check = { "Atan2", 3e-7, 0.0, true };
+    std::vector<float> ys = RandomValues(rng, -1.0f, 1.0f, NUM_CHECK_VALUES);
+    std::vector<float> xs = RandomValues(rng, -1.0f, 1.0f, NUM_CHECK_VALUES);
+    std::vector<float> scales = RandomValues(rng, -20.0f, 20.0f, NUM_CHECK_VALUES);
+    std::vector<float> angles(NUM_CHECK_VALUES), sse_angles(NUM_CHECK_VALUES);
+
+    // spread the vectors over many magnitudes, since only their direction should matter
+    for (unsigned i = 0; i < NUM_CHECK_VALUES; ++i)
+    {
+      float scale = std::exp2(scales[i]);
+
+      xs[i] *= scale;
+      ys[i] *= scale;
+    }
+
+    Atan2Scalar(ys.data(), xs.data(), angles.data(), NUM_CHECK_VALUES);
+    Atan2SSE2(ys.data(), xs.data(), sse_angles.data(), NUM_CHECK_VALUES);
+
+    for (unsigned i = 0; i < NUM_CHECK_VALUES; ++i)
+    {
+      double error = std::abs(angles[i] - std::atan2(static_cast<double>(ys[i]), static_cast<double>(xs[i])));
+
+      // pi and -pi are the same direction
+      check.maxError_ = std::max(check.maxError_, std::min(error, std::abs(error - TWO_PI)));
+    }
+
+    check.sameAsScalar_ = SameBits(angles, sse_angles);
+
+    return check;
+  }
+
+  Check CheckWrapAngles(std::mt19937& rng)
+  {
+    // the error is measured in float spacings of the input (or of 2pi, if that's larger), so the bound is one
+    Check check = { "WrapAngle (ulps)", 1.0, 0.0, true };
+    const float two_pi_spacing = std::nextafter(MathConstants::TWO_PI, FLT_MAX) - MathConstants::TWO_PI;
+    std::vector<float> angles = RandomValues(rng, -1000.0f, 1000.0f, NUM_CHECK_VALUES);
+    std::vector<float> wrapped(angles), sse_wrapped(angles);
+
+    WrapAnglesScalar(wrapped.data(), NUM_CHECK_VALUES);
+    WrapAnglesSSE2(sse_wrapped.data(), NUM_CHECK_VALUES);
+
+    for (unsigned i = 0; i < NUM_CHECK_VALUES; ++i)
+    {
+      double angle = angles[i];
+      double expected = std::fmod(angle, TWO_PI);
+
+      if (expected < 0.0)
+      {
+        expected += TWO_PI;
+      }
+
+      double error = std::abs(wrapped[i] - expected);
+      double spacing = std::max(std::nextafter(std::abs(angles[i]), FLT_MAX) - std::abs(angles[i]), two_pi_spacing);
+
+      if (wrapped[i] < 0.0f || wrapped[i] >= MathConstants::TWO_PI)
+      {
+        error = 1e30;
+      }
+
+      // 0 and 2pi are the same angle
+      check.maxError_ = std::max(check.maxError_, std::min(error, std::abs(error - TWO_PI)) / spacing);
+    }
+
+    check.sameAsScalar_ = SameBits(wrapped, sse_wrapped);
+
+    return check;
+  }
+
+  Check CheckLength(std::mt19937& rng)
+  {
+    // Length is documented as exact, so any difference from sqrt(x * x + y * y) is an error
+    Check check = { "Length", 0.0, 0.0, true };
+    std::vector<float> xs = RandomValues(rng, -1000.0f, 1000.0f, NUM_CHECK_VALUES);
+    std::vector<float> ys = RandomValues(rng, -1000.0f, 1000.0f, NUM_CHECK_VALUES);
+    std::vector<float> lengths(NUM_CHECK_VALUES), sse_lengths(NUM_CHECK_VALUES);
+
+    LengthScalar(xs.data(), ys.data(), lengths.data(), NUM_CHECK_VALUES);
+    LengthSSE2(xs.data(), ys.data(), sse_lengths.data(), NUM_CHECK_VALUES);
+
+    for (unsigned i = 0; i < NUM_CHECK_VALUES; ++i)
+    {
+      float squared_length = xs[i] * xs[i] + ys[i] * ys[i];
+
+      check.maxError_ = std::max(check.maxError_, static_cast<double>(std::abs(lengths[i] - std::sqrt(squared_length))));
+    }
+
+    check.sameAsScalar_ = SameBits(lengths, sse_lengths);
+
+    return check;
+  }
+
+  // nanoseconds per value for the fastest of NUM_PASSES passes
+  template <typename Function>
+  double TimeKernel(Function function)
+  {
+    double best = 1e30;
+
+    for (unsigned pass = 0; pass < NUM_PASSES; ++pass)
+    {
+      auto start = std::chrono::steady_clock::now();
+
+      function();
+
+      auto end = std::chrono::steady_clock::now();
+
+      best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    return best / NUM_VALUES;
+  }
+}
+
+int main()
+{
+  std::mt19937 rng(1234);
+
+  Check checks[] = {
+    CheckSinCos(rng, "SinCos |angle| < 10", 10.0f, 6e-7),
+    CheckSinCos(rng, "SinCos |angle| < 100", 100.0f, 4e-6),
+    CheckSinCos(rng, "SinCos |angle| < 1000", 1000.0f, 3.5e-5),
+    CheckAtan2(rng),
+    CheckWrapAngles(rng),
+    CheckLength(rng)
+  };
+
+  bool passed = true;
+
+  std::printf("accuracy against the C math library, %u values each\n", NUM_CHECK_VALUES);
+  std::printf("%-24s %12s %12s %10s\n", "function", "max error", "bound", "sse2 same");
+
+  for (const Check& check : checks)
+  {
+    bool in_bounds = check.maxError_ <= check.bound_;
+
+    std::printf("%-24s %12.3g %12.3g %10s%s\n", check.name_, check.maxError_, check.bound_, check.sameAsScalar_ ? "yes" : "NO", in_bounds ? "" : "  OUT OF BOUNDS");
+
+    passed = passed && in_bounds && check.sameAsScalar_;
+  }
+
+  if (!passed)
+  {
+    std::printf("accuracy check failed\n");
+    return 1;
+  }
+
+  std::vector<float> angles = RandomValues(rng, -10.0f, 10.0f, NUM_VALUES);
+  std::vector<float> xs = RandomValues(rng, -100.0f, 100.0f, NUM_VALUES);
+  std::vector<float> ys = RandomValues(rng, -100.0f, 100.0f, NUM_VALUES);
+  std::vector<float> out_a(NUM_VALUES), out_b(NUM_VALUES);
+  std::vector<float> wrap_angles = RandomValues(rng, -1000.0f, 1000.0f, NUM_VALUES);
+  std::vector<float> scratch(NUM_VALUES);
+
+  struct Row
+  {
+    const char* name_;
+    SinCosFunction sinCos_;
+    Atan2Function atan2_;
+    WrapAnglesFunction wrapAngles_;
+    LengthFunction length_;
+  };
+
+  Row rows[] = {
+    { "libm", LibmSinCos, LibmAtan2, LibmWrapAngles, LibmLength },
+    { "scalar", SinCosScalar, Atan2Scalar, WrapAnglesScalar, LengthScalar },
+    { "sse2", SinCosSSE2, Atan2SSE2, WrapAnglesSSE2, LengthSSE2 }
+  };
+
+  std::printf("\n%u values, best of %u passes, ns/value\n", NUM_VALUES, NUM_PASSES);
+  std::printf("%-10s %10s %10s %10s %10s\n", "kernel", "SinCos", "Atan2", "WrapAngle", "Length");
+
+  for (const Row& row : rows)
+  {
+    double sin_cos = TimeKernel([&]() { row.sinCos_(angles.data(), out_a.data(), out_b.data(), NUM_VALUES); });
+    double atan2 = TimeKernel([&]() { row.atan2_(ys.data(), xs.data(), out_a.data(), NUM_VALUES); });
+    double wrap = TimeKernel([&]() { std::copy(wrap_angles.begin(), wrap_angles.end(), scratch.begin()); row.wrapAngles_(scratch.data(), NUM_VALUES); });
+    double length = TimeKernel([&]() { row.length_(xs.data(), ys.data(), out_a.data(), NUM_VALUES); });
+
+    std::printf("%-10s %10.3f %10.3f %10.3f %10.3f\n", row.name_, sin_cos, atan2, wrap, length);
+  }
+
+  // keeps the timed results from being optimized away
+  volatile float sink = out_a[0] + out_b[0] + scratch[0];
+  UNREFERENCED(sink);
+
+  return 0;
+}
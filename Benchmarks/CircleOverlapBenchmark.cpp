@@ -0,0 +1,161 @@
+/* ======================================================================== */
+/*!
+ * \file            CircleOverlapBenchmark.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Checks that the SSE2 and AVX2 narrowphase kernels find the same hits as
+   the scalar one, then times all three on runs of circles the size a
+   collision grid query passes them (QUERY_RUN_SIZE), and on one long run.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "Systems/Collision/CircleOverlap.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Barrage;
+
+namespace
+{
+  const unsigned NUM_CIRCLES = 65536;
+  const unsigned NUM_PASSES = 200;
+  const unsigned NUM_CHECK_QUERIES = 1000;
+
+  struct Kernel
+  {
+    const char* name_;
+    CircleOverlapFunction function_;
+  };
+
+  // true if the kernel reports the same hits as the scalar kernel for queries all over the field,
+  // on run lengths that end partway through a SIMD block and partway through a mask word
+  bool MatchesScalar(CircleOverlapFunction kernel, const std::vector<float>& xs, const std::vector<float>& ys, const std::vector<float>& radii)
+  {
+    const unsigned run_sizes[] = { 1, 3, 7, 13, 64, 65, 100, QUERY_RUN_SIZE };
+
+    std::mt19937 rng(4321);
+    std::uniform_real_distribution<float> coordinate(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> radius(0.0f, 40.0f);
+
+    for (unsigned run_size : run_sizes)
+    {
+      unsigned num_words = (run_size + HIT_MASK_BITS - 1) / HIT_MASK_BITS;
+      std::vector<uint64_t> expected(num_words), actual(num_words);
+
+      for (unsigned query = 0; query < NUM_CHECK_QUERIES; ++query)
+      {
+        unsigned begin = (query * QUERY_RUN_SIZE) % (NUM_CIRCLES - run_size);
+        float x = coordinate(rng);
+        float y = coordinate(rng);
+        float r = radius(rng);
+
+        unsigned expected_hits = CircleOverlapScalar(x, y, r, xs.data() + begin, ys.data() + begin, radii.data() + begin, run_size, expected.data());
+        unsigned actual_hits = kernel(x, y, r, xs.data() + begin, ys.data() + begin, radii.data() + begin, run_size, actual.data());
+
+        if (actual_hits != expected_hits)
+        {
+          return false;
+        }
+
+        for (unsigned word = 0; word < num_words; ++word)
+        {
+          unsigned num_bits = std::min(run_size - word * HIT_MASK_BITS, HIT_MASK_BITS);
+          uint64_t used_bits = num_bits == 64 ? ~0ull : (1ull << num_bits) - 1;
+
+          if ((actual[word] & used_bits) != (expected[word] & used_bits))
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // nanoseconds per circle for the fastest of NUM_PASSES passes over every circle
+  double TimeKernel(CircleOverlapFunction kernel, const std::vector<float>& xs, const std::vector<float>& ys, const std::vector<float>& radii, unsigned runSize)
+  {
+    std::vector<uint64_t> hitMask((runSize + HIT_MASK_BITS - 1) / HIT_MASK_BITS);
+    volatile unsigned numHits = 0;
+    double best = 1e30;
+
+    for (unsigned pass = 0; pass < NUM_PASSES; ++pass)
+    {
+      float x = -100.0f + pass;
+      unsigned hits = 0;
+
+      auto start = std::chrono::steady_clock::now();
+
+      for (unsigned begin = 0; begin < NUM_CIRCLES; begin += runSize)
+      {
+        hits += kernel(x, 0.0f, 8.0f, xs.data() + begin, ys.data() + begin, radii.data() + begin, runSize, hitMask.data());
+      }
+
+      auto end = std::chrono::steady_clock::now();
+
+      numHits = numHits + hits;
+      best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    return best / NUM_CIRCLES;
+  }
+}
+
+int main()
+{
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> coordinate(-120.0f, 120.0f);
+  std::vector<float> xs(NUM_CIRCLES), ys(NUM_CIRCLES), radii(NUM_CIRCLES, 2.0f);
+
+  for (unsigned i = 0; i < NUM_CIRCLES; ++i)
+  {
+    xs[i] = coordinate(rng);
+    ys[i] = coordinate(rng);
+  }
+
+  std::vector<Kernel> kernels = { { "scalar", CircleOverlapScalar }, { "sse2", CircleOverlapSSE2 } };
+
+  if (CpuSupportsAVX2())
+  {
+    kernels.push_back({ "avx2", CircleOverlapAVX2 });
+  }
+
+  bool passed = true;
+
+  for (auto it = kernels.begin() + 1; it != kernels.end(); ++it)
+  {
+    bool matches = MatchesScalar(it->function_, xs, ys, radii);
+
+    std::printf("%-10s %s\n", it->name_, matches ? "matches scalar" : "DIFFERS FROM SCALAR");
+
+    passed = passed && matches;
+  }
+
+  if (!passed)
+  {
+    std::printf("narrowphase check failed\n");
+    return 1;
+  }
+
+  std::printf("\n%u circles, best of %u passes\n", NUM_CIRCLES, NUM_PASSES);
+  std::printf("%-10s %18s %18s\n", "kernel", "ns/circle (256)", "ns/circle (65536)");
+
+  for (auto it = kernels.begin(); it != kernels.end(); ++it)
+  {
+    double shortRuns = TimeKernel(it->function_, xs, ys, radii, QUERY_RUN_SIZE);
+    double longRun = TimeKernel(it->function_, xs, ys, radii, NUM_CIRCLES);
+
+    std::printf("%-10s %18.3f %18.3f\n", it->name_, shortRuns, longRun);
+  }
+
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+# =====================================================================================================================
+# File:         CompareDeterminism.cmake
+# Author:       David Cruse
+# Email:        dragonscale.games.llc@gmail.com
+# Date:         10/18/26
+# =====================================================================================================================
+
+# Runs two builds of DeterminismCheck and fails unless they print the same state hash.
+# Usage: cmake -DFIRST=<program> -DSECOND=<program> -P CompareDeterminism.cmake
+
+foreach(PROGRAM FIRST SECOND)
+  execute_process(
+    COMMAND "${${PROGRAM}}"
+    OUTPUT_VARIABLE ${PROGRAM}_HASH
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    RESULT_VARIABLE ${PROGRAM}_RESULT
+  )
+
+  if(NOT ${PROGRAM}_RESULT EQUAL 0)
+    message(FATAL_ERROR "${${PROGRAM}} failed: ${${PROGRAM}_RESULT}")
+  endif()
+endforeach()
+
+if(NOT FIRST_HASH STREQUAL SECOND_HASH)
+  message(FATAL_ERROR "Replay state differs between builds:\n  ${FIRST}: ${FIRST_HASH}\n  ${SECOND}: ${SECOND_HASH}")
+endif()
+
+message(STATUS "Replay state matches between builds: ${FIRST_HASH}")
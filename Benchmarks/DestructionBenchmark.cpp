@@ -0,0 +1,171 @@
+/* ======================================================================== */
+/*!
+ * \file            DestructionBenchmark.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Times ordered and unordered destruction plans at 1%, 10% and 50% death
+   rates. Each pass builds a plan from the destruction bits and applies it
+   to four component arrays, the way DestructionSystem does. Before timing,
+   each plan's survivors are checked against a plain scan of the bits.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "Objects/Components/ComponentArray.hpp"
+#include "Objects/Components/DestructionPlan.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Barrage;
+
+namespace
+{
+  const unsigned NUM_OBJECTS = 65536;
+  const unsigned NUM_ARRAYS = 4;
+  const unsigned NUM_PASSES = 200;
+
+  // stands in for a component like Position or ColorTint
+  struct BenchComponent
+  {
+    float values_[4];
+  };
+
+  // each object's first value is its starting index, so survivors can be told apart after the moves
+  ComponentArrayT<BenchComponent> MakeObjects()
+  {
+    ComponentArrayT<BenchComponent> objects(NUM_OBJECTS);
+
+    for (unsigned i = 0; i < NUM_OBJECTS; ++i)
+    {
+      objects.Data(i).values_[0] = static_cast<float>(i);
+    }
+
+    return objects;
+  }
+
+  void BuildPlan(DestructionPlan& plan, const std::vector<uint64_t>& destroyedBits, unsigned firstDestroyed, bool unordered)
+  {
+    if (unordered)
+    {
+      plan.BuildUnordered(destroyedBits.data(), firstDestroyed, NUM_OBJECTS);
+    }
+    else
+    {
+      plan.Build(destroyedBits.data(), firstDestroyed, NUM_OBJECTS);
+    }
+  }
+
+  // true if the plan keeps the objects whose bits are clear: in their original order for an
+  // ordered plan, in any order for an unordered one
+  bool CheckPlan(const std::vector<uint64_t>& destroyedBits, unsigned firstDestroyed, bool unordered)
+  {
+    std::vector<unsigned> expected;
+
+    for (unsigned i = 0; i < NUM_OBJECTS; ++i)
+    {
+      if ((destroyedBits[i / 64] & (uint64_t(1) << (i % 64))) == 0)
+      {
+        expected.push_back(i);
+      }
+    }
+
+    ComponentArrayT<BenchComponent> objects = MakeObjects();
+    DestructionPlan plan;
+
+    BuildPlan(plan, destroyedBits, firstDestroyed, unordered);
+    objects.HandleDestructions(plan);
+
+    if (plan.numAliveObjects_ != expected.size())
+    {
+      return false;
+    }
+
+    std::vector<unsigned> survivors(plan.numAliveObjects_);
+
+    for (unsigned i = 0; i < plan.numAliveObjects_; ++i)
+    {
+      survivors[i] = static_cast<unsigned>(objects.Data(i).values_[0]);
+    }
+
+    if (unordered)
+    {
+      std::sort(survivors.begin(), survivors.end());
+    }
+
+    return survivors == expected;
+  }
+
+  // microseconds for the fastest of NUM_PASSES passes
+  double TimePlan(const std::vector<uint64_t>& destroyedBits, unsigned firstDestroyed, bool unordered)
+  {
+    ComponentArrayT<BenchComponent> original = MakeObjects();
+    std::vector<ComponentArrayT<BenchComponent>> arrays(NUM_ARRAYS, original);
+    DestructionPlan plan;
+    double best = 1e30;
+
+    for (unsigned pass = 0; pass < NUM_PASSES; ++pass)
+    {
+      std::fill(arrays.begin(), arrays.end(), original);
+
+      auto start = std::chrono::steady_clock::now();
+
+      BuildPlan(plan, destroyedBits, firstDestroyed, unordered);
+
+      for (auto it = arrays.begin(); it != arrays.end(); ++it)
+      {
+        it->HandleDestructions(plan);
+      }
+
+      auto end = std::chrono::steady_clock::now();
+
+      best = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    return best;
+  }
+}
+
+int main()
+{
+  const double deathRates[] = { 0.01, 0.10, 0.50 };
+
+  std::printf("%u objects, %u arrays of %u bytes, best of %u passes\n", NUM_OBJECTS, NUM_ARRAYS, static_cast<unsigned>(sizeof(BenchComponent)), NUM_PASSES);
+  std::printf("%-10s %14s %14s\n", "deaths", "ordered (us)", "unordered (us)");
+
+  for (double deathRate : deathRates)
+  {
+    std::mt19937 rng(1234);
+    std::bernoulli_distribution dies(deathRate);
+    std::vector<uint64_t> destroyedBits((NUM_OBJECTS + 63) / 64, 0);
+    unsigned firstDestroyed = NUM_OBJECTS;
+
+    for (unsigned i = 0; i < NUM_OBJECTS; ++i)
+    {
+      if (dies(rng))
+      {
+        destroyedBits[i / 64] |= uint64_t(1) << (i % 64);
+        firstDestroyed = std::min(firstDestroyed, i);
+      }
+    }
+
+    if (!CheckPlan(destroyedBits, firstDestroyed, false) || !CheckPlan(destroyedBits, firstDestroyed, true))
+    {
+      std::printf("%8.0f%% plan keeps the wrong objects\n", deathRate * 100.0);
+      return 1;
+    }
+
+    double ordered = TimePlan(destroyedBits, firstDestroyed, false);
+    double unordered = TimePlan(destroyedBits, firstDestroyed, true);
+
+    std::printf("%8.0f%% %14.1f %14.1f\n", deathRate * 100.0, ordered, unordered);
+  }
+
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+/* ======================================================================== */
+/*!
+ * \file            DeterminismCheck.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Replays a fixed bullet scene and prints a hash of its final state. The
+   scene runs the engine's own code on real component arrays: spawners
+   fill their objects with the random spawn rules' math, MovementSystem's
+   kernel moves them every tick, and every spawner fires again once a
+   second. At the end, the bullets' angles are read back with Atan2 and a
+   curve baked from where they ended up is sampled.
+
+   With BARRAGE_DETERMINISTIC_MATH on, this program is built at two
+   optimization levels and the determinism test fails if the two builds
+   print different hashes.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "Math/Curves/ArcLengthTable.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
+#include "Systems/Movement/MovementKernels.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+using namespace Barrage;
+
+namespace
+{
+  const unsigned NUM_TICKS = 2000;
+  const unsigned TICKS_PER_WAVE = 60;
+  const unsigned NUM_CURVE_SAMPLES = 256;
+  const unsigned long long SEED = 0x5EEDBA11ull;
+
+  //! Stream ids for each value rule, as a spawn type would hand them out
+  enum RuleId : unsigned
+  {
+    POSITION_RULE,
+    SPEED_RULE,
+    DIRECTION_RULE,
+    ORIENTATION_RULE,
+    ACCELERATION_RULE,
+    TURN_RATE_RULE,
+    ROTATION_RULE
+  };
+
+  //! One spawner's objects. Which movement steps they take picks the kernel they run.
+  struct Spawner
+  {
+    GroupInfo groupInfo_;
+    unsigned startIndex_;
+    bool accelerates_;
+    bool turns_;
+  };
+
+  //! A pool's worth of component arrays
+  struct Scene
+  {
+    Scene(unsigned capacity) :
+      positions_(capacity),
+      velocities_(capacity),
+      accelerations_(capacity),
+      turnRates_(capacity),
+      rotations_(capacity)
+    {
+    }
+
+    PositionArray positions_;
+    VelocityArray velocities_;
+    AccelerationArray accelerations_;
+    TurnRateArray turnRates_;
+    RotationArray rotations_;
+  };
+
+  //! 64-bit FNV-1a over the bytes of each value hashed
+  class StateHash
+  {
+    public:
+      StateHash() : hash_(0xCBF29CE484222325ull) {}
+
+      template <typename T>
+      void Add(const T* values, unsigned count)
+      {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values);
+
+        for (size_t i = 0; i < count * sizeof(T); ++i)
+        {
+          hash_ = (hash_ ^ bytes[i]) * 0x100000001B3ull;
+        }
+      }
+
+      uint64_t Get() const { return hash_; }
+
+    private:
+      uint64_t hash_;
+  };
+
+  // two spawners per movement kernel, with group shapes that cover layer copies and partial tiles
+  std::vector<Spawner> MakeSpawners()
+  {
+    std::vector<Spawner> spawners;
+    unsigned numObjects = 0;
+
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      Spawner spawner;
+
+      spawner.groupInfo_.numGroups_ = 100 + 173 * i;
+      spawner.groupInfo_.numObjectsPerGroup_ = 1 + i % 3;
+      spawner.groupInfo_.numLayerCopies_ = 1 + i / 4;
+      spawner.startIndex_ = numObjects;
+      spawner.accelerates_ = (i & 1) != 0;
+      spawner.turns_ = (i & 2) != 0;
+
+      spawners.push_back(spawner);
+      numObjects += spawner.groupInfo_.GetObjectCount();
+    }
+
+    return spawners;
+  }
+
+  // resets a spawner's objects, then runs the random value rules on them the way a spawn type would
+  void FireSpawner(Scene& scene, const std::vector<Spawner>& spawners, unsigned spawnerIndex, unsigned tick)
+  {
+    const Spawner& spawner = spawners[spawnerIndex];
+    const GroupInfo& groupInfo = spawner.groupInfo_;
+    unsigned startIndex = spawner.startIndex_;
+    unsigned endIndex = startIndex + groupInfo.GetObjectCount();
+
+    for (unsigned i = startIndex; i < endIndex; ++i)
+    {
+      scene.positions_.Data(i) = Position(10.0f * spawnerIndex, -5.0f * spawnerIndex);
+      scene.velocities_.Set(i, Velocity());
+    }
+
+    auto random = [&](RuleId rule) { return CounterRandom(SEED, tick, spawnerIndex, rule); };
+
+    Spawn::ApplyRandomPositionOffsets(scene.positions_, random(POSITION_RULE), groupInfo, startIndex, 50.0f, 30.0f);
+    Spawn::ApplyRandomSpeeds(scene.velocities_, random(SPEED_RULE), groupInfo, startIndex, 0.5f, 3.0f);
+    Spawn::ApplyRandomDirections(scene.velocities_, random(DIRECTION_RULE), groupInfo, startIndex);
+    Spawn::ApplyRandomOrientations(scene.positions_, scene.velocities_, random(ORIENTATION_RULE), groupInfo, startIndex);
+    Spawn::ApplyRandomAccelerations(scene.accelerations_, random(ACCELERATION_RULE), groupInfo, startIndex, -0.01f, 0.01f);
+    Spawn::ApplyRandomTurnRates(scene.turnRates_, random(TURN_RATE_RULE), groupInfo, startIndex, -0.05f, 0.05f);
+    Spawn::ApplyRandomRotations(scene.rotations_, random(ROTATION_RULE), groupInfo, startIndex);
+  }
+
+  void Move(Scene& scene, const std::vector<Spawner>& spawners)
+  {
+    for (const Spawner& spawner : spawners)
+    {
+      const Acceleration* accelerations = spawner.accelerates_ ? scene.accelerations_.GetRaw() : nullptr;
+      const TurnRate* turnRates = spawner.turns_ ? scene.turnRates_.GetRaw() : nullptr;
+      unsigned endIndex = spawner.startIndex_ + spawner.groupInfo_.GetObjectCount();
+
+      MoveObjects(scene.positions_.GetRaw(), scene.velocities_, accelerations, turnRates, spawner.startIndex_, endIndex);
+    }
+  }
+}
+
+int main()
+{
+  std::vector<Spawner> spawners = MakeSpawners();
+  unsigned numObjects = spawners.back().startIndex_ + spawners.back().groupInfo_.GetObjectCount();
+  Scene scene(numObjects);
+
+  for (unsigned tick = 0; tick < NUM_TICKS; ++tick)
+  {
+    if (tick % TICKS_PER_WAVE == 0)
+    {
+      for (unsigned i = 0; i < spawners.size(); ++i)
+      {
+        FireSpawner(scene, spawners, i, tick);
+      }
+    }
+
+    Move(scene, spawners);
+  }
+
+  std::vector<float> angles(numObjects);
+
+  for (unsigned i = 0; i < numObjects; ++i)
+  {
+    angles[i] = scene.velocities_.Get(i).GetAngle().value_;
+  }
+
+  const Position* positions = scene.positions_.GetRaw();
+  BezierCurve curve(positions[0], positions[1], positions[2], positions[3], 16);
+  ArcLengthTable path;
+
+  path.Build(curve);
+
+  std::vector<float> distances(NUM_CURVE_SAMPLES);
+  std::vector<Position> samples(NUM_CURVE_SAMPLES);
+
+  for (unsigned i = 0; i < NUM_CURVE_SAMPLES; ++i)
+  {
+    distances[i] = path.GetLength() * i / (NUM_CURVE_SAMPLES - 1);
+  }
+
+  path.GetPositions(distances.data(), samples.data(), NUM_CURVE_SAMPLES);
+
+  StateHash hash;
+
+  hash.Add(positions, numObjects);
+
+  for (unsigned field = 0; field < VelocityFields::NUM_FIELDS; ++field)
+  {
+    hash.Add(scene.velocities_.GetField(field), numObjects);
+  }
+
+  hash.Add(scene.rotations_.GetRaw(), numObjects);
+  hash.Add(angles.data(), numObjects);
+  hash.Add(samples.data(), NUM_CURVE_SAMPLES);
+
+  std::printf("%016" PRIx64 "\n", hash.Get());
+
+  return 0;
+}
@@ -22,6 +22,7 @@ namespace Barrage
     audioManager_(),
     framerateController_(),
     inputManager_(),
+    jobSystem_(),
     renderer_(),
     sceneManager_(),
     spaceManager_(),
@@ -42,6 +43,7 @@ namespace Barrage
     inputManager_.Initialize(windowManager_.GetWindowHandle());
     renderer_.Initialize(WindowManager::DEFAULT_WIDTH, WindowManager::DEFAULT_HEIGHT);
     audioManager_.Initialize();
+    jobSystem_.Initialize();
 
     framerateController_.Initialize(FramerateController::FpsCap::FPS_120, true);
     
@@ -68,6 +70,7 @@ namespace Barrage
 
   void Engine::Shutdown()
   {
+    jobSystem_.Shutdown();
     audioManager_.Shutdown();
     renderer_.Shutdown();
     inputManager_.Shutdown();
@@ -91,6 +94,11 @@ namespace Barrage
     return inputManager_;
   }
 
+  JobSystem& Engine::Jobs()
+  {
+    return jobSystem_;
+  }
+
   Renderer& Engine::Graphics()
   {
     return renderer_;
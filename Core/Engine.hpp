@@ -18,6 +18,7 @@
 #include "Audio/AudioManager.hpp"
 #include "Framerate/FramerateController.hpp"
 #include "Input/InputManager.hpp"
+#include "Jobs/JobSystem.hpp"
 #include "Renderer/Renderer.hpp"
 #include "Scenes/SceneManager.hpp"
 #include "Spaces/SpaceManager.hpp"
@@ -129,6 +130,17 @@ namespace Barrage
       /**************************************************************/
       InputManager& Input();
 
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the engine's job system.
+
+        \return
+          Returns a reference to the engine's job system.
+      */
+      /**************************************************************/
+      JobSystem& Jobs();
+
       /**************************************************************/
       /*!
         \brief
@@ -185,6 +197,7 @@ namespace Barrage
       AudioManager audioManager_;
       FramerateController framerateController_;
       InputManager inputManager_;
+      JobSystem jobSystem_;
       Renderer renderer_;
       SceneManager sceneManager_;
       SpaceManager spaceManager_;
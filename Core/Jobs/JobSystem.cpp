@@ -0,0 +1,194 @@
+/* ======================================================================== */
+/*!
+ * \file            JobSystem.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A small thread pool that runs jobs submitted by the engine. Threads that
+   wait on a job counter help run queued jobs until the counter hits zero,
+   so waiting never deadlocks (and work still gets done if the job system
+   has no worker threads).
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "JobSystem.hpp"
+
+namespace Barrage
+{
+  JobSystem::JobSystem() :
+    workers_(),
+    jobs_(),
+    mutex_(),
+    jobAvailable_(),
+    jobFinished_(),
+    errors_(),
+    stopping_(false)
+  {
+  }
+
+  JobSystem::~JobSystem()
+  {
+    Shutdown();
+  }
+
+  void JobSystem::Initialize(unsigned numWorkers)
+  {
+    Shutdown();
+
+    if (numWorkers == 0)
+    {
+      unsigned numHardwareThreads = std::thread::hardware_concurrency();
+
+      numWorkers = numHardwareThreads > 1 ? numHardwareThreads - 1 : 0;
+    }
+
+    stopping_ = false;
+
+    for (unsigned i = 0; i < numWorkers; ++i)
+    {
+      workers_.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+  }
+
+  void JobSystem::Shutdown()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+
+    jobAvailable_.notify_all();
+
+    for (std::thread& worker : workers_)
+    {
+      worker.join();
+    }
+
+    workers_.clear();
+
+    // anything still queued runs on this thread so no counter is left hanging
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!jobs_.empty())
+    {
+      QueuedJob queuedJob = std::move(jobs_.front());
+      jobs_.pop_front();
+
+      lock.unlock();
+      Run(queuedJob);
+      lock.lock();
+    }
+
+    stopping_ = false;
+  }
+
+  unsigned JobSystem::GetWorkerCount() const
+  {
+    return static_cast<unsigned>(workers_.size());
+  }
+
+  void JobSystem::Submit(Job job, JobCounter* counter)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(QueuedJob{ std::move(job), counter });
+    }
+
+    // a thread in WaitFor may be idle and able to take the job too
+    jobAvailable_.notify_one();
+    jobFinished_.notify_all();
+  }
+
+  void JobSystem::WaitFor(const JobCounter& counter)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (counter.load() != 0)
+    {
+      if (!jobs_.empty())
+      {
+        QueuedJob queuedJob = std::move(jobs_.front());
+        jobs_.pop_front();
+
+        lock.unlock();
+        Run(queuedJob);
+        lock.lock();
+      }
+      else
+      {
+        jobFinished_.wait(lock, [&]() { return counter.load() == 0 || !jobs_.empty(); });
+      }
+    }
+
+    auto it = errors_.find(&counter);
+
+    if (it != errors_.end())
+    {
+      std::exception_ptr error = it->second;
+
+      errors_.erase(it);
+      lock.unlock();
+      std::rethrow_exception(error);
+    }
+  }
+
+  void JobSystem::WorkerLoop()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+      jobAvailable_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+
+      if (stopping_)
+      {
+        return;
+      }
+
+      QueuedJob queuedJob = std::move(jobs_.front());
+      jobs_.pop_front();
+
+      lock.unlock();
+      Run(queuedJob);
+      lock.lock();
+    }
+  }
+
+  void JobSystem::Run(QueuedJob& queuedJob)
+  {
+    std::exception_ptr error;
+
+    try
+    {
+      queuedJob.job_();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      if (error && queuedJob.counter_)
+      {
+        // only the first exception is kept, later ones are dropped
+        errors_.emplace(queuedJob.counter_, error);
+      }
+      else if (error)
+      {
+        spdlog::error("A job with no counter threw an exception.");
+      }
+
+      if (queuedJob.counter_)
+      {
+        queuedJob.counter_->fetch_sub(1);
+      }
+    }
+
+    jobFinished_.notify_all();
+  }
+}
\ No newline at end of file
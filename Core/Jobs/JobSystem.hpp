@@ -0,0 +1,168 @@
+/* ======================================================================== */
+/*!
+ * \file            JobSystem.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A small thread pool that runs jobs submitted by the engine. Threads that
+   wait on a job counter help run queued jobs until the counter hits zero,
+   so waiting never deadlocks (and work still gets done if the job system
+   has no worker threads).
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef JobSystem_BARRAGE_H
+#define JobSystem_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Barrage
+{
+  using Job = std::function<void()>;
+  using JobCounter = std::atomic<unsigned>;
+
+  //! Runs jobs on a pool of worker threads
+  class JobSystem
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Default constructor. The job system has no worker threads
+          until it's initialized.
+      */
+      /**************************************************************/
+      JobSystem();
+
+      JobSystem(const JobSystem&) = delete;
+      JobSystem& operator=(const JobSystem&) = delete;
+      JobSystem(JobSystem&&) = delete;
+      JobSystem& operator=(JobSystem&&) = delete;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Stops all worker threads.
+      */
+      /**************************************************************/
+      ~JobSystem();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Starts the worker threads.
+
+        \param numWorkers
+          The number of worker threads to start. If zero, one worker
+          is started per hardware thread, minus one for the thread
+          that submits and waits on jobs.
+      */
+      /**************************************************************/
+      void Initialize(unsigned numWorkers = 0);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Finishes all queued jobs and stops the worker threads.
+      */
+      /**************************************************************/
+      void Shutdown();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of worker threads (not counting threads
+          that help out while waiting).
+
+        \return
+          Returns the number of worker threads.
+      */
+      /**************************************************************/
+      unsigned GetWorkerCount() const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Queues a job. The job decrements the counter (if one is
+          given) once it has finished, even if it throws. An
+          exception thrown by the job is rethrown by WaitFor() on the
+          same counter.
+
+        \param job
+          The job to run.
+
+        \param counter
+          The counter to decrement when the job finishes. The caller
+          increments it before submitting.
+      */
+      /**************************************************************/
+      void Submit(Job job, JobCounter* counter = nullptr);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Blocks until a counter reaches zero, running queued jobs
+          on the calling thread in the meantime. If any job that
+          reported to the counter threw, the first exception is
+          rethrown once the counter reaches zero.
+
+        \param counter
+          The counter to wait on.
+      */
+      /**************************************************************/
+      void WaitFor(const JobCounter& counter);
+
+    private:
+      //! A queued job and the counter it reports to
+      struct QueuedJob
+      {
+        Job job_;             //!< The work to do
+        JobCounter* counter_; //!< Decremented after the job runs (may be nullptr)
+      };
+
+      /**************************************************************/
+      /*!
+        \brief
+          Loop run by each worker thread.
+      */
+      /**************************************************************/
+      void WorkerLoop();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Runs a job and reports its completion. Exceptions are kept
+          for the job's counter instead of escaping the thread.
+
+        \param queuedJob
+          The job to run.
+      */
+      /**************************************************************/
+      void Run(QueuedJob& queuedJob);
+
+    private:
+      std::vector<std::thread> workers_;                        //!< Worker threads
+      std::deque<QueuedJob> jobs_;                              //!< Jobs that haven't started yet
+      std::mutex mutex_;                                        //!< Guards jobs_, errors_ and stopping_
+      std::condition_variable jobAvailable_;                    //!< Signaled when a job is queued or workers should stop
+      std::condition_variable jobFinished_;                     //!< Signaled when any job finishes
+      std::map<const JobCounter*, std::exception_ptr> errors_;  //!< First exception thrown by a job, by counter
+      bool stopping_;                                           //!< True when workers should exit
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // JobSystem_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
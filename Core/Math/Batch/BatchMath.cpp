@@ -0,0 +1,279 @@
+/* ======================================================================== */
+/*!
+ * \file            BatchMath.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Fast float math for gameplay code: sine/cosine, atan2, angle wrapping,
+   vector length and normalization. Each function comes in a single value
+   version and a version that runs over whole arrays. On x64 the array
+   versions use SSE2 and give exactly the same results as the single value
+   versions, so code can mix the two freely.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "BatchMath.hpp"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BARRAGE_X64
+#include <emmintrin.h>
+#endif
+
+namespace Barrage
+{
+  void SinCos(const float* angles, float* sines, float* cosines, unsigned count)
+  {
+    SinCosSSE2(angles, sines, cosines, count);
+  }
+
+  void Atan2(const float* ys, const float* xs, float* angles, unsigned count)
+  {
+    Atan2SSE2(ys, xs, angles, count);
+  }
+
+  void WrapAngles(float* angles, unsigned count)
+  {
+    WrapAnglesSSE2(angles, count);
+  }
+
+  void Length(const float* xs, const float* ys, float* lengths, unsigned count)
+  {
+    LengthSSE2(xs, ys, lengths, count);
+  }
+
+  void Normalize(float* xs, float* ys, float* lengths, unsigned count)
+  {
+    NormalizeSSE2(xs, ys, lengths, count);
+  }
+
+  void SinCosScalar(const float* angles, float* sines, float* cosines, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      float sine, cosine;
+
+      SinCos(angles[i], sine, cosine);
+
+      sines[i] = sine;
+      cosines[i] = cosine;
+    }
+  }
+
+  void Atan2Scalar(const float* ys, const float* xs, float* angles, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      angles[i] = Atan2(ys[i], xs[i]);
+    }
+  }
+
+  void WrapAnglesScalar(float* angles, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      angles[i] = WrapAngle(angles[i]);
+    }
+  }
+
+  void LengthScalar(const float* xs, const float* ys, float* lengths, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      lengths[i] = Length(xs[i], ys[i]);
+    }
+  }
+
+  void NormalizeScalar(float* xs, float* ys, float* lengths, unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      float length = Normalize(xs[i], ys[i]);
+
+      if (lengths)
+      {
+        lengths[i] = length;
+      }
+    }
+  }
+
+#ifdef BARRAGE_X64
+  namespace
+  {
+    // picks a where mask is set and b elsewhere
+    __m128 Select(__m128 mask, __m128 a, __m128 b)
+    {
+      return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+  }
+
+  void SinCosSSE2(const float* angles, float* sines, float* cosines, unsigned count)
+  {
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 angle = _mm_loadu_ps(angles + i);
+      __m128 round = _mm_set1_ps(12582912.0f);
+      __m128 quadrant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(angle, _mm_set1_ps(0.636619772f)), round), round);
+
+      __m128 x = _mm_add_ps(_mm_sub_ps(angle, _mm_mul_ps(quadrant, _mm_set1_ps(MathConstants::HALF_PI))), _mm_mul_ps(quadrant, _mm_set1_ps(MathConstants::HALF_PI_ERROR)));
+      __m128 x2 = _mm_mul_ps(x, x);
+
+      __m128 s = _mm_add_ps(_mm_set1_ps(8.33333333e-03f), _mm_mul_ps(x2, _mm_set1_ps(-1.98412698e-04f)));
+      s = _mm_add_ps(_mm_set1_ps(-1.66666667e-01f), _mm_mul_ps(x2, s));
+      s = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, x2), s));
+
+      __m128 c = _mm_add_ps(_mm_set1_ps(-1.38888889e-03f), _mm_mul_ps(x2, _mm_set1_ps(2.48015873e-05f)));
+      c = _mm_add_ps(_mm_set1_ps(4.16666667e-02f), _mm_mul_ps(x2, c));
+      c = _mm_add_ps(_mm_set1_ps(-0.5f), _mm_mul_ps(x2, c));
+      c = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, c));
+
+      __m128i q = _mm_cvttps_epi32(quadrant);
+      __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+
+      // bit 1 of q (or q + 1) shifted up to the sign bit flips the sign
+      __m128 sine_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+      __m128 cosine_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+      _mm_storeu_ps(sines + i, _mm_xor_ps(Select(swap, c, s), sine_sign));
+      _mm_storeu_ps(cosines + i, _mm_xor_ps(Select(swap, s, c), cosine_sign));
+    }
+
+    SinCosScalar(angles + i, sines + i, cosines + i, count - i);
+  }
+
+  void Atan2SSE2(const float* ys, const float* xs, float* angles, unsigned count)
+  {
+    const __m128 sign_bit = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 y = _mm_loadu_ps(ys + i);
+      __m128 x = _mm_loadu_ps(xs + i);
+      __m128 abs_x = _mm_andnot_ps(sign_bit, x);
+      __m128 abs_y = _mm_andnot_ps(sign_bit, y);
+
+      __m128 x_larger = _mm_cmpgt_ps(abs_x, abs_y);
+      __m128 larger = Select(x_larger, abs_x, abs_y);
+      __m128 smaller = Select(x_larger, abs_y, abs_x);
+      __m128 ratio = _mm_and_ps(_mm_cmpgt_ps(larger, _mm_setzero_ps()), _mm_div_ps(smaller, larger));
+
+      __m128 one = _mm_set1_ps(1.0f);
+      __m128 reduce = _mm_cmpgt_ps(ratio, _mm_set1_ps(0.414213562f));
+      __m128 t = Select(reduce, _mm_div_ps(_mm_sub_ps(ratio, one), _mm_add_ps(ratio, one)), ratio);
+      __m128 base = _mm_and_ps(reduce, _mm_set1_ps(MathConstants::QUARTER_PI));
+      __m128 t2 = _mm_mul_ps(t, t);
+
+      __m128 p = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(8.05374449538e-2f), t2), _mm_set1_ps(1.38776856032e-1f));
+      p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(1.99777106478e-1f));
+      p = _mm_sub_ps(_mm_mul_ps(p, t2), _mm_set1_ps(3.33329491539e-1f));
+      __m128 angle = _mm_add_ps(base, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, t2), t), t));
+
+      angle = Select(_mm_cmpgt_ps(abs_y, abs_x), _mm_sub_ps(_mm_set1_ps(MathConstants::HALF_PI), angle), angle);
+
+      __m128 x_negative = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+      angle = Select(x_negative, _mm_sub_ps(_mm_set1_ps(MathConstants::PI), angle), angle);
+      angle = _mm_xor_ps(angle, _mm_and_ps(y, sign_bit));
+
+      _mm_storeu_ps(angles + i, angle);
+    }
+
+    Atan2Scalar(ys + i, xs + i, angles + i, count - i);
+  }
+
+  void WrapAnglesSSE2(float* angles, unsigned count)
+  {
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 angle = _mm_loadu_ps(angles + i);
+      __m128 scaled = _mm_mul_ps(angle, _mm_set1_ps(MathConstants::INVERSE_TWO_PI));
+
+      // SSE2 has no floor, so truncate and step down where that rounded up
+      __m128 turns = _mm_cvtepi32_ps(_mm_cvttps_epi32(scaled));
+      turns = _mm_sub_ps(turns, _mm_and_ps(_mm_cmpgt_ps(turns, scaled), _mm_set1_ps(1.0f)));
+
+      __m128 two_pi = _mm_set1_ps(MathConstants::TWO_PI);
+      __m128 wrapped = _mm_add_ps(_mm_sub_ps(angle, _mm_mul_ps(turns, two_pi)), _mm_mul_ps(turns, _mm_set1_ps(MathConstants::TWO_PI_ERROR)));
+
+      wrapped = Select(_mm_cmplt_ps(wrapped, _mm_setzero_ps()), _mm_add_ps(wrapped, two_pi), wrapped);
+      wrapped = Select(_mm_cmpge_ps(wrapped, two_pi), _mm_sub_ps(wrapped, two_pi), wrapped);
+
+      _mm_storeu_ps(angles + i, wrapped);
+    }
+
+    WrapAnglesScalar(angles + i, count - i);
+  }
+
+  void LengthSSE2(const float* xs, const float* ys, float* lengths, unsigned count)
+  {
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 x = _mm_loadu_ps(xs + i);
+      __m128 y = _mm_loadu_ps(ys + i);
+
+      _mm_storeu_ps(lengths + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+    }
+
+    LengthScalar(xs + i, ys + i, lengths + i, count - i);
+  }
+
+  void NormalizeSSE2(float* xs, float* ys, float* lengths, unsigned count)
+  {
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 x = _mm_loadu_ps(xs + i);
+      __m128 y = _mm_loadu_ps(ys + i);
+      __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+
+      // zero vectors get a scale of zero instead of infinity
+      __m128 inverse_length = _mm_and_ps(_mm_cmpgt_ps(length, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), length));
+
+      _mm_storeu_ps(xs + i, _mm_mul_ps(x, inverse_length));
+      _mm_storeu_ps(ys + i, _mm_mul_ps(y, inverse_length));
+
+      if (lengths)
+      {
+        _mm_storeu_ps(lengths + i, length);
+      }
+    }
+
+    NormalizeScalar(xs + i, ys + i, lengths ? lengths + i : nullptr, count - i);
+  }
+#else
+  void SinCosSSE2(const float* angles, float* sines, float* cosines, unsigned count)
+  {
+    SinCosScalar(angles, sines, cosines, count);
+  }
+
+  void Atan2SSE2(const float* ys, const float* xs, float* angles, unsigned count)
+  {
+    Atan2Scalar(ys, xs, angles, count);
+  }
+
+  void WrapAnglesSSE2(float* angles, unsigned count)
+  {
+    WrapAnglesScalar(angles, count);
+  }
+
+  void LengthSSE2(const float* xs, const float* ys, float* lengths, unsigned count)
+  {
+    LengthScalar(xs, ys, lengths, count);
+  }
+
+  void NormalizeSSE2(float* xs, float* ys, float* lengths, unsigned count)
+  {
+    NormalizeScalar(xs, ys, lengths, count);
+  }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,279 @@
+/* ======================================================================== */
+/*!
+ * \file            BatchMath.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Fast float math for gameplay code: sine/cosine, atan2, angle wrapping,
+   vector length and normalization. Each function comes in a single value
+   version and a version that runs over whole arrays. On x64 the array
+   versions use SSE2 and give exactly the same results as the single value
+   versions, so code can mix the two freely.
+
+   Precision (absolute error, checked against the C math library):
+     SinCos    below 6e-7 for |angle| < 10, 4e-6 below 100, 3.5e-5 below 1000
+     Atan2     below 3e-7 radians
+     WrapAngle below the float spacing of the input angle (or of 2pi, for
+               angles smaller than that)
+     Length    exact sqrt of the squared length, rounded to float
+
+   Benchmarks/BatchMathBenchmark checks these bounds before it times
+   anything.
+
+   Every function here is built from +, -, *, / and sqrt, which IEEE floats
+   round the same way everywhere. That makes results identical across
+   compilers and machines as long as the compiler doesn't fuse or reorder
+   operations, which is what BARRAGE_DETERMINISTIC_MATH makes sure of.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BatchMath_BARRAGE_H
+#define BatchMath_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cfloat>
+
+// deterministic builds must fail loudly if a flag sneaks in that breaks them
+#ifdef BARRAGE_DETERMINISTIC_MATH
+#if defined(__FAST_MATH__) || defined(_M_FP_FAST)
+#error "BARRAGE_DETERMINISTIC_MATH can't be combined with fast math"
+#endif
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+#error "BARRAGE_DETERMINISTIC_MATH needs float math done at float precision (use SSE2, not x87)"
+#endif
+#endif
+
+namespace Barrage
+{
+  namespace MathConstants
+  {
+    constexpr float PI = 3.14159274f;                //!< Pi rounded to float
+    constexpr float HALF_PI = 1.57079637f;           //!< Pi / 2 rounded to float
+    constexpr float QUARTER_PI = 0.785398185f;       //!< Pi / 4 rounded to float
+    constexpr float TWO_PI = 6.28318548f;            //!< 2 * pi rounded to float
+    constexpr float INVERSE_TWO_PI = 0.159154937f;   //!< 1 / (2 * pi) rounded to float
+    constexpr float HALF_PI_ERROR = 4.37113883e-08f; //!< How much HALF_PI overshoots pi / 2
+    constexpr float TWO_PI_ERROR = 1.74845553e-07f;  //!< How much TWO_PI overshoots 2 * pi
+  }
+
+  /**************************************************************/
+  /*!
+    \brief
+      Computes the sine and cosine of an angle with polynomials
+      instead of C library calls. The angle must be finite; it's
+      meant for angles within about a million radians of zero.
+
+    \param angle
+      The angle in radians.
+
+    \param sine
+      Receives the sine of the angle.
+
+    \param cosine
+      Receives the cosine of the angle.
+  */
+  /**************************************************************/
+  inline void SinCos(float angle, float& sine, float& cosine);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Computes the angle of the vector (x, y), like atan2(y, x).
+      Signed zeros are handled like the C library does.
+
+    \param y
+      The y component of the vector.
+
+    \param x
+      The x component of the vector.
+
+    \return
+      Returns the angle in radians, in [-pi, pi]. Returns 0 for
+      the zero vector.
+  */
+  /**************************************************************/
+  inline float Atan2(float y, float x);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Wraps an angle into [0, 2pi). Meant for angles within a few
+      million turns of zero.
+
+    \param angle
+      The angle in radians.
+
+    \return
+      Returns the equivalent angle in [0, 2pi).
+  */
+  /**************************************************************/
+  inline float WrapAngle(float angle);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Computes the length of the vector (x, y).
+
+    \param x
+      The x component of the vector.
+
+    \param y
+      The y component of the vector.
+
+    \return
+      Returns the length of the vector.
+  */
+  /**************************************************************/
+  inline float Length(float x, float y);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Scales the vector (x, y) to unit length. The zero vector
+      stays zero.
+
+    \param x
+      The x component of the vector.
+
+    \param y
+      The y component of the vector.
+
+    \return
+      Returns the length the vector had before it was normalized.
+  */
+  /**************************************************************/
+  inline float Normalize(float& x, float& y);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Computes SinCos() for an array of angles. Any of the arrays
+      may be the same array.
+
+    \param angles
+      The angles in radians.
+
+    \param sines
+      Receives the sine of each angle.
+
+    \param cosines
+      Receives the cosine of each angle.
+
+    \param count
+      The number of angles.
+  */
+  /**************************************************************/
+  void SinCos(const float* angles, float* sines, float* cosines, unsigned count);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Computes Atan2() for arrays of vector components. The output
+      may be the same array as either input.
+
+    \param ys
+      The y components of the vectors.
+
+    \param xs
+      The x components of the vectors.
+
+    \param angles
+      Receives the angle of each vector.
+
+    \param count
+      The number of vectors.
+  */
+  /**************************************************************/
+  void Atan2(const float* ys, const float* xs, float* angles, unsigned count);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Applies WrapAngle() to an array of angles in place.
+
+    \param angles
+      The angles to wrap.
+
+    \param count
+      The number of angles.
+  */
+  /**************************************************************/
+  void WrapAngles(float* angles, unsigned count);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Computes Length() for arrays of vector components. The
+      output may be the same array as either input.
+
+    \param xs
+      The x components of the vectors.
+
+    \param ys
+      The y components of the vectors.
+
+    \param lengths
+      Receives the length of each vector.
+
+    \param count
+      The number of vectors.
+  */
+  /**************************************************************/
+  void Length(const float* xs, const float* ys, float* lengths, unsigned count);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Applies Normalize() to arrays of vector components in place.
+
+    \param xs
+      The x components of the vectors.
+
+    \param ys
+      The y components of the vectors.
+
+    \param lengths
+      If not null, receives the length each vector had before it
+      was normalized.
+
+    \param count
+      The number of vectors.
+  */
+  /**************************************************************/
+  void Normalize(float* xs, float* ys, float* lengths, unsigned count);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Reference versions of the array functions without SIMD.
+  */
+  /**************************************************************/
+  void SinCosScalar(const float* angles, float* sines, float* cosines, unsigned count);
+  void Atan2Scalar(const float* ys, const float* xs, float* angles, unsigned count);
+  void WrapAnglesScalar(float* angles, unsigned count);
+  void LengthScalar(const float* xs, const float* ys, float* lengths, unsigned count);
+  void NormalizeScalar(float* xs, float* ys, float* lengths, unsigned count);
+
+  /**************************************************************/
+  /*!
+    \brief
+      SSE2 versions of the array functions, four values at a time.
+      Fall back to the scalar versions where SSE2 isn't available.
+  */
+  /**************************************************************/
+  void SinCosSSE2(const float* angles, float* sines, float* cosines, unsigned count);
+  void Atan2SSE2(const float* ys, const float* xs, float* angles, unsigned count);
+  void WrapAnglesSSE2(float* angles, unsigned count);
+  void LengthSSE2(const float* xs, const float* ys, float* lengths, unsigned count);
+  void NormalizeSSE2(float* xs, float* ys, float* lengths, unsigned count);
+}
+
+#include "BatchMath.tpp"
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // BatchMath_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
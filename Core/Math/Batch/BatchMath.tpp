@@ -0,0 +1,132 @@
+/* ======================================================================== */
+/*!
+ * \file            BatchMath.tpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Fast float math for gameplay code: sine/cosine, atan2, angle wrapping,
+   vector length and normalization. Each function comes in a single value
+   version and a version that runs over whole arrays. On x64 the array
+   versions use SSE2 and give exactly the same results as the single value
+   versions, so code can mix the two freely.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BatchMath_BARRAGE_T
+#define BatchMath_BARRAGE_T
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+// The SSE2 kernels in BatchMath.cpp repeat these steps operation for operation.
+// Keep the two in sync, or the array and single value versions will disagree.
+
+namespace Barrage
+{
+  inline void SinCos(float angle, float& sine, float& cosine)
+  {
+    // adding and subtracting 1.5 * 2^23 rounds to the nearest integer, the same way SSE2 does
+    float quadrant = (angle * 0.636619772f + 12582912.0f) - 12582912.0f;
+
+    // reduce to [-pi/4, pi/4] around the nearest multiple of pi/2 (pi/2 split in two for precision)
+    float x = (angle - quadrant * MathConstants::HALF_PI) + quadrant * MathConstants::HALF_PI_ERROR;
+    float x2 = x * x;
+
+    float s = x + x * x2 * (-1.66666667e-01f + x2 * (8.33333333e-03f + x2 * -1.98412698e-04f));
+    float c = 1.0f + x2 * (-0.5f + x2 * (4.16666667e-02f + x2 * (-1.38888889e-03f + x2 * 2.48015873e-05f)));
+
+    // odd quadrants swap sine and cosine; the sign pattern repeats every four quadrants
+    int q = static_cast<int>(quadrant);
+    bool swap = q & 1;
+
+    sine = swap ? c : s;
+    cosine = swap ? s : c;
+
+    if (q & 2)
+    {
+      sine = -sine;
+    }
+
+    if ((q + 1) & 2)
+    {
+      cosine = -cosine;
+    }
+  }
+
+  inline float Atan2(float y, float x)
+  {
+    float abs_x = std::fabs(x);
+    float abs_y = std::fabs(y);
+    float larger = abs_x > abs_y ? abs_x : abs_y;
+    float smaller = abs_x > abs_y ? abs_y : abs_x;
+    float ratio = larger > 0.0f ? smaller / larger : 0.0f;
+
+    // atan(r) = pi/4 + atan((r - 1) / (r + 1)), which keeps the polynomial's input below tan(pi/8)
+    bool reduce = ratio > 0.414213562f;
+    float t = reduce ? (ratio - 1.0f) / (ratio + 1.0f) : ratio;
+    float base = reduce ? MathConstants::QUARTER_PI : 0.0f;
+    float t2 = t * t;
+
+    float angle = base + ((((8.05374449538e-2f * t2 - 1.38776856032e-1f) * t2 + 1.99777106478e-1f) * t2 - 3.33329491539e-1f) * t2 * t + t);
+
+    // unfold from the first octant
+    if (abs_y > abs_x)
+    {
+      angle = MathConstants::HALF_PI - angle;
+    }
+
+    if (std::signbit(x))
+    {
+      angle = MathConstants::PI - angle;
+    }
+
+    if (std::signbit(y))
+    {
+      angle = -angle;
+    }
+
+    return angle;
+  }
+
+  inline float WrapAngle(float angle)
+  {
+    float turns = std::floor(angle * MathConstants::INVERSE_TWO_PI);
+    float wrapped = (angle - turns * MathConstants::TWO_PI) + turns * MathConstants::TWO_PI_ERROR;
+
+    // rounding can leave the result a hair outside the range
+    if (wrapped < 0.0f)
+    {
+      wrapped += MathConstants::TWO_PI;
+    }
+
+    if (wrapped >= MathConstants::TWO_PI)
+    {
+      wrapped -= MathConstants::TWO_PI;
+    }
+
+    return wrapped;
+  }
+
+  inline float Length(float x, float y)
+  {
+    return std::sqrt(x * x + y * y);
+  }
+
+  inline float Normalize(float& x, float& y)
+  {
+    float length = Length(x, y);
+    float inverse_length = length > 0.0f ? 1.0f / length : 0.0f;
+
+    x *= inverse_length;
+    y *= inverse_length;
+
+    return length;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // BatchMath_BARRAGE_T
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,74 @@
+/* ======================================================================== */
+/*!
+ * \file            RotationTable.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Remembers the cosines and sines of evenly spaced angles, so patterns
+   that fire the same spread over and over only do the trig once.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "RotationTable.hpp"
+#include "BatchMath.hpp"
+
+namespace Barrage
+{
+  RotationTable::RotationTable() :
+    entries_(),
+    useCount_(0)
+  {
+  }
+
+  const RotationTable::Entry& RotationTable::Get(unsigned numAngles, float startAngle, float spacing)
+  {
+    if (entries_.size() >= MAX_ENTRIES && entries_.find(numAngles) == entries_.end())
+    {
+      auto oldest = entries_.begin();
+
+      for (auto it = entries_.begin(); it != entries_.end(); ++it)
+      {
+        if (it->second.lastUse_ < oldest->second.lastUse_)
+        {
+          oldest = it;
+        }
+      }
+
+      entries_.erase(oldest);
+    }
+
+    Entry& entry = entries_[numAngles];
+
+    entry.lastUse_ = ++useCount_;
+
+    // a new entry has no angles yet, so it's always built
+    if (!entry.cosines_.empty() && entry.startAngle_ == startAngle && entry.spacing_ == spacing)
+    {
+      return entry;
+    }
+
+    entry.cosines_.resize(numAngles);
+    entry.sines_.resize(numAngles);
+
+    // the angles are written into the sine array, then replaced by their sines
+    for (unsigned i = 0; i < numAngles; ++i)
+    {
+      entry.sines_[i] = startAngle + i * spacing;
+    }
+
+    SinCos(entry.sines_.data(), entry.sines_.data(), entry.cosines_.data(), numAngles);
+
+    entry.startAngle_ = startAngle;
+    entry.spacing_ = spacing;
+
+    return entry;
+  }
+
+  void RotationTable::Clear()
+  {
+    entries_.clear();
+  }
+}
\ No newline at end of file
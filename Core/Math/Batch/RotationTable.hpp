@@ -0,0 +1,95 @@
+/* ======================================================================== */
+/*!
+ * \file            RotationTable.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Remembers the cosines and sines of evenly spaced angles, so patterns
+   that fire the same spread over and over only do the trig once.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RotationTable_BARRAGE_H
+#define RotationTable_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+namespace Barrage
+{
+  //! Cosines and sines of evenly spaced angles, kept for the angle counts used most recently
+  class RotationTable
+  {
+    public:
+      static constexpr unsigned MAX_ENTRIES = 8; //!< Most angle counts kept at once
+
+      //! The cosine and sine of each angle in a spread
+      struct Entry
+      {
+        float startAngle_;            //!< The first angle the entry was built for
+        float spacing_;               //!< The spacing the entry was built for
+        std::vector<float> cosines_;  //!< Cosine of each angle
+        std::vector<float> sines_;    //!< Sine of each angle
+        unsigned long long lastUse_;  //!< When the entry was last asked for (see useCount_)
+      };
+
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs an empty table.
+      */
+      /**************************************************************/
+      RotationTable();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the cosines and sines of the angles
+          startAngle + i * spacing, for i in [0, numAngles). They're
+          computed with SinCos() the first time a count is asked
+          for and reused while the start angle and spacing for that
+          count stay the same. If either changes, the count's entry
+          is rebuilt.
+
+          At most MAX_ENTRIES counts are kept. Asking for a new count
+          when the table is full drops the one that went unused the
+          longest, so a spawner whose group count keeps changing
+          can't grow the table without bound.
+
+        \param numAngles
+          The number of angles.
+
+        \param startAngle
+          The first angle, in radians.
+
+        \param spacing
+          The difference between neighboring angles, in radians.
+
+        \return
+          Returns the cosine and sine of each angle. The entry is only
+          valid until the next call.
+      */
+      /**************************************************************/
+      const Entry& Get(unsigned numAngles, float startAngle, float spacing);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Forgets every stored entry.
+      */
+      /**************************************************************/
+      void Clear();
+
+    private:
+      std::map<unsigned, Entry> entries_;   //!< Stored entries, by angle count (one start angle and spacing per count)
+      unsigned long long useCount_;         //!< Number of calls to Get() so far
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // RotationTable_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,120 @@
+/* ======================================================================== */
+/*!
+ * \file            ArcLengthTable.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Bakes a bezier curve into points spaced evenly by distance along the
+   curve, so objects can follow it at a constant speed and many positions
+   can be looked up in one pass.
+ */
+/* ======================================================================== */
+
+#include "ArcLengthTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Barrage
+{
+  ArcLengthTable::ArcLengthTable() :
+    xs_(),
+    ys_(),
+    length_(0.0f),
+    inverseSpacing_(0.0f),
+    numIntervals_(0)
+  {
+  }
+
+  void ArcLengthTable::Build(const BezierCurve& curve, unsigned numSamples)
+  {
+    numIntervals_ = std::max(numSamples, 1u);
+
+    // measure the curve finely in t, keeping the running length at each step
+    unsigned num_steps = numIntervals_ * OVERSAMPLING;
+    std::vector<double> lengths(num_steps + 1, 0.0);
+    Position previous = curve.GeneratePoint(0.0);
+
+    for (unsigned step = 1; step <= num_steps; ++step)
+    {
+      Position current = curve.GeneratePoint(static_cast<double>(step) / num_steps);
+      double dx = current.x_ - previous.x_;
+      double dy = current.y_ - previous.y_;
+
+      // sqrt is exactly rounded everywhere; hypot's result depends on the C library
+      lengths[step] = lengths[step - 1] + std::sqrt(dx * dx + dy * dy);
+      previous = current;
+    }
+
+    double total_length = lengths.back();
+
+    xs_.resize(numIntervals_ + 1);
+    ys_.resize(numIntervals_ + 1);
+
+    // targets only increase, so the step search picks up where the last one stopped
+    unsigned step = 0;
+
+    for (unsigned i = 0; i <= numIntervals_; ++i)
+    {
+      double target = total_length * i / numIntervals_;
+
+      while (step + 1 < num_steps && lengths[step + 1] < target)
+      {
+        ++step;
+      }
+
+      double step_length = lengths[step + 1] - lengths[step];
+      double fraction = step_length > 0.0 ? (target - lengths[step]) / step_length : 0.0;
+      Position point = curve.GeneratePoint((step + std::min(std::max(fraction, 0.0), 1.0)) / num_steps);
+
+      xs_[i] = point.x_;
+      ys_[i] = point.y_;
+    }
+
+    length_ = static_cast<float>(total_length);
+    inverseSpacing_ = length_ > 0.0f ? numIntervals_ / length_ : 0.0f;
+  }
+
+  float ArcLengthTable::GetLength() const
+  {
+    return length_;
+  }
+
+  Position ArcLengthTable::GetPosition(float distance) const
+  {
+    Position position;
+
+    GetPositions(&distance, &position, 1);
+
+    return position;
+  }
+
+  void ArcLengthTable::GetPositions(const float* distances, Position* positions, unsigned count) const
+  {
+    if (xs_.empty())
+    {
+      std::fill(positions, positions + count, Position(0.0f, 0.0f));
+      return;
+    }
+
+    const float max_index = static_cast<float>(numIntervals_);
+    const float* xs = xs_.data();
+    const float* ys = ys_.data();
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      // written so NaN distances land on the start of the curve
+      float index = distances[i] * inverseSpacing_;
+      index = index > 0.0f ? index : 0.0f;
+      index = index < max_index ? index : max_index;
+
+      unsigned start = std::min(static_cast<unsigned>(index), numIntervals_ - 1);
+      float fraction = index - start;
+
+      positions[i].x_ = xs[start] + (xs[start + 1] - xs[start]) * fraction;
+      positions[i].y_ = ys[start] + (ys[start + 1] - ys[start]) * fraction;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/* ======================================================================== */
+/*!
+ * \file            ArcLengthTable.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Bakes a bezier curve into points spaced evenly by distance along the
+   curve, so objects can follow it at a constant speed and many positions
+   can be looked up in one pass.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef ArcLengthTable_BARRAGE_H
+#define ArcLengthTable_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "BezierCurve.hpp"
+
+#include <vector>
+
+namespace Barrage
+{
+  //! A curve sampled at even distances along its length
+  class ArcLengthTable
+  {
+    public:
+      static constexpr unsigned DEFAULT_SAMPLES = 256;    //!< Points in a table unless told otherwise
+      static constexpr unsigned OVERSAMPLING = 8;         //!< Curve points measured per table point while baking
+
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs an empty table. Every lookup returns (0, 0)
+          until the table is built.
+      */
+      /**************************************************************/
+      ArcLengthTable();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Bakes a curve into the table.
+
+        \param curve
+          The curve to bake.
+
+        \param numSamples
+          The number of intervals the curve is split into. The table
+          holds one more point than this.
+      */
+      /**************************************************************/
+      void Build(const BezierCurve& curve, unsigned numSamples = DEFAULT_SAMPLES);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the length of the baked curve.
+
+        \return
+          Returns the length of the curve in world units.
+      */
+      /**************************************************************/
+      float GetLength() const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the point some distance along the curve.
+
+        \param distance
+          The distance from the start of the curve. Distances outside
+          [0, GetLength()] are clamped to the ends of the curve.
+
+        \return
+          Returns the point on the curve.
+      */
+      /**************************************************************/
+      Position GetPosition(float distance) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Looks up GetPosition() for a run of distances.
+
+        \param distances
+          The distances from the start of the curve.
+
+        \param positions
+          Receives the point on the curve for each distance.
+
+        \param count
+          The number of distances.
+      */
+      /**************************************************************/
+      void GetPositions(const float* distances, Position* positions, unsigned count) const;
+
+    private:
+      std::vector<float> xs_;   //!< X coordinates of the points, evenly spaced by distance
+      std::vector<float> ys_;   //!< Y coordinates of the points
+      float length_;            //!< Length of the curve
+      float inverseSpacing_;    //!< Number of intervals per unit of distance
+      unsigned numIntervals_;   //!< Number of intervals between points
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // ArcLengthTable_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -138,7 +138,7 @@ namespace Barrage
     return (t - startIndex * pointStep) / pointStep;
   }
 
-  Position BezierCurve::GeneratePoint(double t)
+  Position BezierCurve::GeneratePoint(double t) const
   {
     double u = 1 - t;
     double tt = t * t;
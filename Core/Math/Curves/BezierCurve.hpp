@@ -52,11 +52,11 @@ namespace Barrage
 
       Position GetPosition(double t);
 
+      Position GeneratePoint(double t) const;
+
     private:
       double GetLerpFactor(size_t startIndex, double t);
       
-      Position GeneratePoint(double t);
-      
       void BuildCurve();
 
     private:
@@ -37,4 +37,21 @@ namespace Barrage
       }
     }
   }
+
+  ComponentArrayTable ObjectArchetype::GetComponentArrayTable() const
+  {
+    ComponentArrayTable table(ComponentFactory::GetComponentArrayCount());
+
+    for (auto it = componentArrays_.begin(); it != componentArrays_.end(); ++it)
+    {
+      unsigned id = ComponentFactory::GetComponentArrayId(it->first);
+
+      if (id != INVALID_COMPONENT_ID)
+      {
+        table[id] = it->second;
+      }
+    }
+
+    return table;
+  }
 }
\ No newline at end of file
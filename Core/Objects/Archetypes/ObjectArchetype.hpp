@@ -34,6 +34,19 @@ namespace Barrage
       /**************************************************************/
       ObjectArchetype(const std::string& name, const StringSet& componentArrayNames = StringSet());
 
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the archetype's component arrays indexed by component
+          array ID, so they can be copied without looking up names.
+
+        \return
+          Returns a table with one entry per registered component
+          array (nullptr where the archetype doesn't have the array).
+      */
+      /**************************************************************/
+      ComponentArrayTable GetComponentArrayTable() const;
+
     public:
       std::string name_;                  //!< Name of the object archetype
       ComponentArrayMap componentArrays_; //!< A map of initialized components to copy (each array in this map has only one component)
@@ -21,9 +21,11 @@ namespace Barrage
   PoolArchetype::PoolArchetype() :
     name_("Unnamed"),
     capacity_(1),
+    maxCapacity_(0),
     components_(),
     componentArrayNames_(),
     tags_(),
+    unorderedDestruction_(false),
     startingObjects_(),
     spawnArchetypes_()
   {
@@ -32,9 +34,11 @@ namespace Barrage
   PoolArchetype::PoolArchetype(const std::string& name, unsigned capacity) :
     name_(name),
     capacity_(capacity),
+    maxCapacity_(0),
     components_(),
     componentArrayNames_(),
     tags_(),
+    unorderedDestruction_(false),
     startingObjects_(),
     spawnArchetypes_()
   {
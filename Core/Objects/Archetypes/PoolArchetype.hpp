@@ -45,9 +45,11 @@ namespace Barrage
     public:
       std::string name_;              //!< Name of the pool this archetype will create
       unsigned capacity_;             //!< The number of objects the pool will be able to hold
+      unsigned maxCapacity_;          //!< The pool may grow up to this many objects when full (no growth if <= capacity)
       ComponentMap components_;       //!< Initialized components to copy to the pool
       StringSet componentArrayNames_; //!< Names of the pool's component arrays
       StringSet tags_;                //!< Tags of the pool
+      bool unorderedDestruction_;     //!< If true, destroyed objects are replaced by the pool's last objects (spawn order isn't kept)
 
       ObjectArchetypeMap startingObjects_; //!< Objects present in the pool at the start of a scene
       ObjectArchetypeMap spawnArchetypes_; //!< Objects that can be spawned in the pool
@@ -156,9 +156,9 @@ namespace Barrage
     public:
       BehaviorNodeWithArray(const std::string& name, BehaviorNodeType type);
 
-      virtual void SetCapacity(unsigned capacity) = 0;
+      virtual void SetCapacity(unsigned capacity, unsigned numObjects) = 0;
 
-      virtual void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) = 0;
+      virtual void HandleDestructions(const DestructionPlan& plan) = 0;
 
       bool HasArray() override;
   };
@@ -175,9 +175,9 @@ namespace Barrage
 
       void SetRTTRValue(const rttr::variant& value) override;
 
-      void SetCapacity(unsigned capacity) override;
+      void SetCapacity(unsigned capacity, unsigned numObjects) override;
 
-      void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) override;
+      void HandleDestructions(const DestructionPlan& plan) override;
 
     protected:
       T data_;
@@ -89,17 +89,18 @@ namespace Barrage
   }
 
   template <typename T, typename A>
-  void BehaviorNodeTA<T, A>::SetCapacity(unsigned capacity)
+  void BehaviorNodeTA<T, A>::SetCapacity(unsigned capacity, unsigned numObjects)
   {
-    dataArray_.SetCapacity(capacity);
+    dataArray_.SetCapacity(capacity, numObjects);
+    dataArray_.Resize(capacity);
   }
 
   template <typename T, typename A>
-  void BehaviorNodeTA<T, A>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void BehaviorNodeTA<T, A>::HandleDestructions(const DestructionPlan& plan)
   {
-    unsigned numAliveObjects = dataArray_.HandleDestructions(destructionArray, writeIndex, endIndex);
+    dataArray_.HandleDestructions(plan);
 
-    for (unsigned i = numAliveObjects; i < endIndex; ++i)
+    for (unsigned i = plan.numAliveObjects_; i < plan.endIndex_; ++i)
     {
       dataArray_.Data(i) = A();
     }
@@ -87,7 +87,7 @@ namespace Barrage
       {
         std::shared_ptr<BehaviorNodeWithArray> behaviorNodePtr = std::static_pointer_cast<BehaviorNodeWithArray>(behaviorNode.Get());
 
-        behaviorNodePtr->SetCapacity(capacity_);
+        behaviorNodePtr->SetCapacity(capacity_, 0);
       }
     }
   }
@@ -172,19 +172,32 @@ namespace Barrage
     tree_.at(nodeIndex)->OnBegin(info);
   }
 
-  void BehaviorTree::SetCapacity(unsigned capacity)
+  void BehaviorTree::SetCapacity(unsigned capacity, unsigned numObjects)
   {
     capacity_ = capacity;
 
-    nodeIndices_.SetCapacity(capacity);
+    nodeIndices_.SetCapacity(capacity, numObjects);
+    nodeIndices_.Resize(capacity);
 
-    for (unsigned i = 0; i < capacity; ++i)
+    for (unsigned i = numObjects; i < capacity; ++i)
     {
       nodeIndices_.Data(i) = BEHAVIOR_BEGIN;
     }
+
+    for (auto it = tree_.begin(); it != tree_.end(); ++it)
+    {
+      DeepPtr<BehaviorNode>& behaviorNode = *it;
+
+      if (behaviorNode->HasArray())
+      {
+        std::shared_ptr<BehaviorNodeWithArray> behaviorNodePtr = std::static_pointer_cast<BehaviorNodeWithArray>(behaviorNode.Get());
+
+        behaviorNodePtr->SetCapacity(capacity, numObjects);
+      }
+    }
   }
 
-  void BehaviorTree::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void BehaviorTree::HandleDestructions(const DestructionPlan& plan)
   {
     // TODO: optimize (store indices to array nodes)
 
@@ -196,13 +209,13 @@ namespace Barrage
       {
         std::shared_ptr<BehaviorNodeWithArray> behaviorNodePtr = std::static_pointer_cast<BehaviorNodeWithArray>(behaviorNode.Get());
 
-        behaviorNodePtr->HandleDestructions(destructionArray, writeIndex, endIndex);
+        behaviorNodePtr->HandleDestructions(plan);
       }
     }
 
-    unsigned numAliveObjects = nodeIndices_.HandleDestructions(destructionArray, writeIndex, endIndex);
+    nodeIndices_.HandleDestructions(plan);
 
-    for (unsigned i = numAliveObjects; i < endIndex; ++i)
+    for (unsigned i = plan.numAliveObjects_; i < plan.endIndex_; ++i)
     {
       nodeIndices_.Data(i) = BEHAVIOR_BEGIN;
     }
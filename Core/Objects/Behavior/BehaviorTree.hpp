@@ -45,9 +45,9 @@ namespace Barrage
 
       void OnBeginNode(BehaviorNodeInfo& info, int nodeIndex);
 
-      void SetCapacity(unsigned capacity);
+      void SetCapacity(unsigned capacity, unsigned numObjects);
 
-      void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex);
+      void HandleDestructions(const DestructionPlan& plan);
 
       void PrintNode(std::ostream& os, const std::string& name, unsigned level) const;
 
@@ -62,9 +62,13 @@ namespace Barrage
 
         \param capacity
           The new capacity to set.
+
+        \param numObjects
+          The number of objects whose data should be kept (objects
+          past this point are reset to default values).
       */
       /**************************************************************/
-      virtual void SetCapacity(unsigned capacity) = 0;
+      virtual void SetCapacity(unsigned capacity, unsigned numObjects) = 0;
 
       /**************************************************************/
       /*!
@@ -72,21 +76,12 @@ namespace Barrage
           Handles destructions for any per-object data in the 
           component.
 
-        \param destructionArray
-          Array of bools denoting whether an object at a given index
-          is destroyed (true) or alive (false).
-
-        \param writeIndex
-          The index of the first dead object.
-
-        \param endIndex
-          One past the index of the last object that could be alive.
-
-        \return
-          Returns the number of alive objects.
+        \param plan
+          The moves that pack the pool's alive objects, built once
+          from the pool's destruction flags.
       */
       /**************************************************************/
-      virtual void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) = 0;
+      virtual void HandleDestructions(const DestructionPlan& plan) = 0;
 
       /**************************************************************/
       /*!
@@ -156,9 +151,13 @@ namespace Barrage
 
         \param capacity
           The new capacity to set.
+
+        \param numObjects
+          The number of objects whose data should be kept (objects
+          past this point are reset to default values).
       */
       /**************************************************************/
-      void SetCapacity(unsigned capacity) override;
+      void SetCapacity(unsigned capacity, unsigned numObjects) override;
 
       /**************************************************************/
       /*!
@@ -167,21 +166,12 @@ namespace Barrage
           component. Default implementation does nothing; must be
           specialized if component has per-object data.
 
-        \param destructionArray
-          Array of bools denoting whether an object at a given index
-          is destroyed (true) or alive (false).
-
-        \param writeIndex
-          The index of the first dead object.
-
-        \param endIndex
-          One past the index of the last object that could be alive.
-
-        \return
-          Returns the number of alive objects.
+        \param plan
+          The moves that pack the pool's alive objects, built once
+          from the pool's destruction flags.
       */
       /**************************************************************/
-      void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) override;
+      void HandleDestructions(const DestructionPlan& plan) override;
 
       /**************************************************************/
       /*!
@@ -221,6 +211,7 @@ namespace Barrage
   };
 
   using ComponentMap = std::map<std::string, DeepPtr<Component>>;
+  using ComponentTable = std::vector<DeepPtr<Component>>;
 }
 
 #include "Component.tpp"
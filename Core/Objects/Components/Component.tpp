@@ -38,16 +38,13 @@ namespace Barrage
   }
 
   template <typename T>
-  void ComponentT<T>::SetCapacity([[maybe_unused]] unsigned capacity)
+  void ComponentT<T>::SetCapacity([[maybe_unused]] unsigned capacity, [[maybe_unused]] unsigned numObjects)
   {
     // intentionally empty, should be specialized in component classes that have per-object data
   }
 
   template <typename T>
-  void ComponentT<T>::HandleDestructions(
-    [[maybe_unused]] const Destructible* destructionArray,
-    [[maybe_unused]] unsigned writeIndex,
-    [[maybe_unused]] unsigned endIndex)
+  void ComponentT<T>::HandleDestructions([[maybe_unused]] const DestructionPlan& plan)
   {
     // intentionally empty, should be specialized in component classes that have per-object data
   }
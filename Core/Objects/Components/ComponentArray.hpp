@@ -10,6 +10,11 @@
    Component arrays are used when each object in a pool needs its own copy
    of a component.
    For instance, each object may need its own position component.
+
+   Component array storage is aligned to a cache line and allocated without
+   being initialized. Components are only constructed when an object is
+   first spawned into a slot, so unused capacity costs no construction time
+   (and isn't touched at all until it's needed).
  */
  /* ======================================================================== */
 
@@ -19,21 +24,28 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Utilities/DeepPtr.hpp"
+#include "Objects/Components/DestructionPlan.hpp"
 
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
+#include <cstddef>
 #include <rttr/variant.h>
 #include <rttr/registration.h>
 
 namespace Barrage
 {
+  constexpr std::size_t COMPONENT_ARRAY_ALIGNMENT = 64; //!< Alignment of component array storage (one cache line)
+
   //!< Keeps track of whether an object is marked for destruction
   struct Destructible
   {
     bool destroyed_; //!< true if marked for destruction
 
     inline Destructible() : destroyed_(false) {}
+
+    inline explicit Destructible(bool destroyed) : destroyed_(destroyed) {}
   };
   
   //! Base component array class that all component arrays inherit from
@@ -93,25 +105,78 @@ namespace Barrage
       /**************************************************************/
       /*!
         \brief
-          Using the destructionArray to see which objects have been
-          destroyed, tightly packs the remaining alive objects at
-          the beginning of the array.
+          Copies a single component from some source component array
+          to every component in the range 
+          [recipientIndex, recipientIndex + count) of this array.
 
-        \param destructionArray
-          Array of bools denoting whether an object at a given index
-          is destroyed (true) or alive (false).
+        \param source
+          The component array holding the component to copy from. The
+          source may be this component array.
 
-        \param writeIndex
-          The index of the first dead object.
+        \param sourceIndex
+          The index of the component to copy from.
 
-        \param endIndex
-          One past the index of the last object that could be alive.
+        \param recipientIndex
+          The index of the first component in this array to copy to.
 
-        \return
-          Returns the number of alive objects.
+        \param count
+          The number of components to write.
+      */
+      /**************************************************************/
+      virtual void FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) = 0;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies the range [sourceIndex, sourceIndex + count) of some
+          source component array to the range
+          [recipientIndex, recipientIndex + count) of this array.
+
+        \param source
+          The component array holding the components to copy from.
+          The source may be this component array, and the ranges may
+          overlap.
+
+        \param sourceIndex
+          The index of the first component to copy from.
+
+        \param recipientIndex
+          The index of the first component in this array to copy to.
+
+        \param count
+          The number of components to copy.
+      */
+      /**************************************************************/
+      virtual void CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) = 0;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Applies a destruction plan to the array, tightly packing
+          the remaining alive objects at the beginning of the array.
+
+        \param plan
+          The moves that pack the pool's alive objects, built once
+          from the pool's destruction flags.
       */
       /**************************************************************/
-      virtual unsigned HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) = 0;
+      virtual void HandleDestructions(const DestructionPlan& plan) = 0;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reallocates the array with a new capacity.
+
+        \param capacity
+          The new capacity to set.
+
+        \param numObjects
+          The number of objects whose data should be kept (slots
+          past this point are left unconstructed until objects are
+          spawned into them).
+      */
+      /**************************************************************/
+      virtual void SetCapacity(unsigned capacity, unsigned numObjects) = 0;
 
       /**************************************************************/
       /*!
@@ -162,7 +227,9 @@ namespace Barrage
       /**************************************************************/
       /*!
         \brief
-          Constructs a component array with the given capacity.
+          Constructs a component array with the given capacity. Every
+          slot is default constructed (use SetCapacity() on an empty
+          array to get uninitialized storage instead).
 
         \param capacity
           The number of components held in the array.
@@ -217,7 +284,8 @@ namespace Barrage
           Copies a component from some source component array to a
           recipient component in this component array. The arrays
           should be the same type (this function is not safety
-          checked).
+          checked). Slots skipped between the constructed range and
+          recipientIndex are value initialized.
 
         \param source
           The component array holding the component to copy from. The
@@ -236,37 +304,117 @@ namespace Barrage
       /**************************************************************/
       /*!
         \brief
-          Reallocates the data array with a new capacity.
-          Note: Sets all values to default values.
+          Copies a single component from some source component array
+          to every component in the range 
+          [recipientIndex, recipientIndex + count) of this array. The
+          arrays should be the same type (this function is not safety
+          checked). Slots past the constructed range are copy
+          constructed.
+
+        \param source
+          The component array holding the component to copy from. The
+          source may be this component array.
+
+        \param sourceIndex
+          The index of the component to copy from.
+
+        \param recipientIndex
+          The index of the first component in this array to copy to.
+
+        \param count
+          The number of components to write.
+      */
+      /**************************************************************/
+      void FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies the range [sourceIndex, sourceIndex + count) of some
+          source component array to the range
+          [recipientIndex, recipientIndex + count) of this array. The
+          arrays should be the same type (this function is not safety
+          checked). Trivially copyable components are copied with a
+          single memmove. Slots past the constructed range are copy
+          constructed, and any slots skipped between the constructed
+          range and recipientIndex are value initialized.
+
+        \param source
+          The component array holding the components to copy from.
+          The source may be this component array, and the ranges may
+          overlap.
+
+        \param sourceIndex
+          The index of the first component to copy from.
+
+        \param recipientIndex
+          The index of the first component in this array to copy to.
+
+        \param count
+          The number of components to copy.
+      */
+      /**************************************************************/
+      void CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reallocates the data array with a new capacity. The first
+          numObjects components are moved to the new storage; slots
+          past them are left unconstructed.
 
         \param capacity
           The new capacity to set.
+
+        \param numObjects
+          The number of objects whose data should be kept.
       */
       /**************************************************************/
-      void SetCapacity(unsigned capacity);
+      void SetCapacity(unsigned capacity, unsigned numObjects) override;
 
       /**************************************************************/
       /*!
         \brief
-          Using the destructionArray to see which objects have been
-          destroyed, tightly packs the remaining alive objects at
-          the beginning of the array.
+          Constructs or destroys components so that exactly the first
+          size slots of the array hold constructed components. New
+          components are value initialized.
+
+          Arrays owned by components (per-object timers, spawn rule
+          data, etc.) aren't filled when objects spawn, so their
+          owners call Resize(GetCapacity()) after SetCapacity() to
+          keep every slot valid.
+
+        \param size
+          The number of constructed components to have (clamped to
+          the array's capacity).
+      */
+      /**************************************************************/
+      void Resize(unsigned size);
 
-        \param destructionArray
-          Array of bools denoting whether an object at a given index
-          is destroyed (true) or alive (false).
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of slots (from the start of the array) that
+          hold constructed components.
 
-        \param writeIndex
-          The index of the first dead object.
+        \return
+          Returns the number of constructed components.
+      */
+      /**************************************************************/
+      unsigned GetSize() const;
 
-        \param endIndex
-          One past the index of the last object that could be alive.
+      /**************************************************************/
+      /*!
+        \brief
+          Applies a destruction plan to the array, tightly packing
+          the remaining alive objects at the beginning of the array.
 
-        \return
-          Returns the number of alive objects.
+        \param plan
+          The moves that pack the pool's alive objects, built once
+          from the pool's destruction flags.
       */
       /**************************************************************/
-      unsigned HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) override;
+      void HandleDestructions(const DestructionPlan& plan) override;
 
       /**************************************************************/
       /*!
@@ -282,6 +430,20 @@ namespace Barrage
       /**************************************************************/
       T& Data(int index);
 
+      /**************************************************************/
+      /*!
+        \brief
+          Accesses the component at a given index in the array.
+
+        \param i
+          The index of the component to access.
+
+        \return
+          Returns a const reference to the accessed component.
+      */
+      /**************************************************************/
+      const T& Data(int index) const;
+
       /**************************************************************/
       /*!
         \brief
@@ -320,10 +482,52 @@ namespace Barrage
       T* GetRaw();
 
     private:
-      T* data_;
+      /**************************************************************/
+      /*!
+        \brief
+          Allocates aligned, uninitialized storage for some number of
+          components.
+
+        \param capacity
+          The number of components the storage should fit.
+
+        \return
+          Returns a pointer to the storage.
+      */
+      /**************************************************************/
+      static T* Allocate(unsigned capacity);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Frees storage returned by Allocate(). Components in the
+          storage must already be destroyed.
+
+        \param data
+          The storage to free.
+      */
+      /**************************************************************/
+      static void Deallocate(T* data);
+
+    private:
+      T* data_;       //!< Aligned storage for capacity_ components
+      unsigned size_; //!< Number of constructed components at the start of data_
+
+      static constexpr std::size_t alignment_ = alignof(T) > COMPONENT_ARRAY_ALIGNMENT ? alignof(T) : COMPONENT_ARRAY_ALIGNMENT;
   };
 
+  //! Selects the array type that stores a component (specialize to change a component's storage)
+  template <typename T>
+  struct ComponentArrayStorage
+  {
+    using Type = ComponentArrayT<T>; //!< Array type used for the component
+  };
+
+  template <typename T>
+  using ComponentArrayType = typename ComponentArrayStorage<T>::Type;
+
   using ComponentArrayMap = std::map<std::string, DeepPtr<ComponentArray>>;
+  using ComponentArrayTable = std::vector<DeepPtr<ComponentArray>>;
 }
 
 #include "ComponentArray.tpp"
@@ -17,46 +17,55 @@
 #define ComponentArray_BARRAGE_T
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
 namespace Barrage
 {
   template <typename T>
   ComponentArrayT<T>::ComponentArrayT(unsigned capacity) :
     ComponentArray(capacity),
-    data_(nullptr)
+    data_(nullptr),
+    size_(0)
   {
-    data_ = new T[capacity];
+    data_ = Allocate(capacity);
+    Resize(capacity);
   }
 
   template <typename T>
   ComponentArrayT<T>::ComponentArrayT(const ComponentArrayT<T>& other) :
     ComponentArray(other.capacity_),
-    data_(nullptr)
+    data_(nullptr),
+    size_(0)
   {
-    data_ = new T[capacity_];
-
-    for (unsigned i = 0; i < capacity_; ++i)
-    {
-      data_[i] = other.data_[i];
-    }
+    data_ = Allocate(capacity_);
+    std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+    size_ = other.size_;
   }
 
   template <typename T>
   ComponentArrayT<T>& ComponentArrayT<T>::operator=(const ComponentArrayT<T>& other)
   {
-    SetCapacity(other.capacity_);
-
-    for (unsigned i = 0; i < capacity_; ++i)
+    if (this == &other)
     {
-      data_[i] = other.data_[i];
+      return *this;
     }
 
+    SetCapacity(other.capacity_, 0);
+    std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+    size_ = other.size_;
+
     return *this;
   }
 
   template <typename T>
   ComponentArrayT<T>::~ComponentArrayT()
   {
-    delete[] data_;
+    std::destroy(data_, data_ + size_);
+    Deallocate(data_);
   }
 
   template <typename T>
@@ -70,31 +79,141 @@ namespace Barrage
   {
     const ComponentArrayT<T>& source_derived = static_cast<const ComponentArrayT<T>&>(source);
 
-    data_[recipientIndex] = source_derived.data_[sourceIndex];
+    if (recipientIndex < size_)
+    {
+      data_[recipientIndex] = source_derived.data_[sourceIndex];
+    }
+    else
+    {
+      // slots skipped over must hold constructed components too, since they count as live
+      Resize(recipientIndex);
+
+      new (data_ + recipientIndex) T(source_derived.data_[sourceIndex]);
+      size_ = recipientIndex + 1;
+    }
+  }
+
+  template <typename T>
+  void ComponentArrayT<T>::FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count)
+  {
+    const ComponentArrayT<T>& source_derived = static_cast<const ComponentArrayT<T>&>(source);
+
+    // copy the prototype first in case it lives inside the range being filled
+    const T prototype = source_derived.data_[sourceIndex];
+    unsigned endIndex = recipientIndex + count;
+    unsigned numAssigned = size_ > recipientIndex ? std::min(count, size_ - recipientIndex) : 0;
+
+    std::fill_n(data_ + recipientIndex, numAssigned, prototype);
+
+    // slots no object has been spawned into yet are constructed here
+    if (endIndex > size_)
+    {
+      std::uninitialized_fill(data_ + size_, data_ + endIndex, prototype);
+      size_ = endIndex;
+    }
+  }
+
+  template <typename T>
+  void ComponentArrayT<T>::CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count)
+  {
+    const ComponentArrayT<T>& source_derived = static_cast<const ComponentArrayT<T>&>(source);
+    const T* source_begin = source_derived.data_ + sourceIndex;
+    T* recipient_begin = data_ + recipientIndex;
+
+    if (count == 0 || source_begin == recipient_begin)
+    {
+      return;
+    }
+
+    unsigned endIndex = recipientIndex + count;
+
+    // slots skipped over must hold constructed components too, since they count as live
+    if (recipientIndex > size_)
+    {
+      Resize(recipientIndex);
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+      std::memmove(recipient_begin, source_begin, count * sizeof(T));
+    }
+    else if (endIndex > size_)
+    {
+      // the range runs past the constructed slots, so the source can only overlap it from below;
+      // construct the tail first, then assign back to front
+      unsigned numAssigned = size_ - recipientIndex;
+
+      std::uninitialized_copy(source_begin + numAssigned, source_begin + count, data_ + size_);
+      std::copy_backward(source_begin, source_begin + numAssigned, recipient_begin + numAssigned);
+    }
+    else if (recipient_begin < source_begin)
+    {
+      std::copy(source_begin, source_begin + count, recipient_begin);
+    }
+    else
+    {
+      std::copy_backward(source_begin, source_begin + count, recipient_begin + count);
+    }
+
+    if (endIndex > size_)
+    {
+      size_ = endIndex;
+    }
   }
 
   template <typename T>
-  void ComponentArrayT<T>::SetCapacity(unsigned capacity)
+  void ComponentArrayT<T>::SetCapacity(unsigned capacity, unsigned numObjects)
   {
+    T* data = Allocate(capacity);
+    unsigned numKept = std::min(numObjects, std::min(capacity, size_));
+
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+      std::memcpy(data, data_, numKept * sizeof(T));
+    }
+    else
+    {
+      std::uninitialized_move(data_, data_ + numKept, data);
+    }
+
+    std::destroy(data_, data_ + size_);
+    Deallocate(data_);
+
+    data_ = data;
+    size_ = numKept;
     capacity_ = capacity;
-    delete[] data_;
-    data_ = new T[capacity_];
   }
 
   template <typename T>
-  unsigned ComponentArrayT<T>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void ComponentArrayT<T>::Resize(unsigned size)
   {
-    for (unsigned i = writeIndex + 1; i < endIndex; ++i)
+    size = std::min(size, capacity_);
+
+    if (size > size_)
     {
-      if (destructionArray[i].destroyed_ == false)
-      {
-        data_[writeIndex] = data_[i];
-        ++writeIndex;
-      }
+      std::uninitialized_value_construct(data_ + size_, data_ + size);
     }
+    else
+    {
+      std::destroy(data_ + size, data_ + size_);
+    }
+
+    size_ = size;
+  }
+
+  template <typename T>
+  unsigned ComponentArrayT<T>::GetSize() const
+  {
+    return size_;
+  }
 
-    // now that the array's packed, the number of alive objects is the same as the next write index
-    return writeIndex;
+  template <typename T>
+  void ComponentArrayT<T>::HandleDestructions(const DestructionPlan& plan)
+  {
+    for (const ObjectMove& move : plan.moves_)
+    {
+      ComponentArrayT<T>::CopyRangeToThis(*this, move.sourceIndex_, move.recipientIndex_, move.count_);
+    }
   }
 
   template <typename T>
@@ -103,6 +222,12 @@ namespace Barrage
     return data_[index];
   }
 
+  template <typename T>
+  const T& ComponentArrayT<T>::Data(int index) const
+  {
+    return data_[index];
+  }
+
   template <typename T>
   rttr::variant ComponentArrayT<T>::GetRTTRValue(int index) const
   {
@@ -119,7 +244,15 @@ namespace Barrage
       return;
     }
 
-    data_[index] = value.get_value<T>();
+    if (static_cast<unsigned>(index) < size_)
+    {
+      data_[index] = value.get_value<T>();
+    }
+    else if (static_cast<unsigned>(index) == size_ && size_ < capacity_)
+    {
+      new (data_ + index) T(value.get_value<T>());
+      size_++;
+    }
   }
 
   template <typename T>
@@ -127,6 +260,18 @@ namespace Barrage
   {
     return data_;
   }
+
+  template <typename T>
+  T* ComponentArrayT<T>::Allocate(unsigned capacity)
+  {
+    return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(alignment_)));
+  }
+
+  template <typename T>
+  void ComponentArrayT<T>::Deallocate(T* data)
+  {
+    ::operator delete(data, std::align_val_t(alignment_));
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
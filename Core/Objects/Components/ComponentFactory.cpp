@@ -23,9 +23,27 @@ namespace Barrage
   StringSet ComponentFactory::componentArrayNames_ = StringSet();
   StringSet ComponentFactory::tagNames_ = StringSet();
 
+  ComponentIdMap ComponentFactory::componentIds_ = ComponentIdMap();
+  ComponentIdMap ComponentFactory::componentArrayIds_ = ComponentIdMap();
+  ComponentIdMap ComponentFactory::tagIds_ = ComponentIdMap();
+  std::vector<std::string> ComponentFactory::componentArrayList_ = std::vector<std::string>();
+
   void ComponentFactory::RegisterTag(const std::string& tag)
   {
+    if (tagIds_.count(tag))
+    {
+      return;
+    }
+
+    unsigned id = static_cast<unsigned>(tagIds_.size());
+
+    if (id >= MAX_REGISTERED_COMPONENTS)
+    {
+      throw std::runtime_error("Could not register tag \"" + tag + "\" (too many tags registered).");
+    }
+
     tagNames_.insert(tag);
+    tagIds_[tag] = id;
   }
 
   DeepPtr<Component> ComponentFactory::AllocateComponent(const std::string& name, DeepPtr<Component> initializer)
@@ -68,4 +86,40 @@ namespace Barrage
   {
     return tagNames_;
   }
+
+  unsigned ComponentFactory::GetComponentId(const std::string& name)
+  {
+    auto it = componentIds_.find(name);
+
+    return it == componentIds_.end() ? INVALID_COMPONENT_ID : it->second;
+  }
+
+  unsigned ComponentFactory::GetComponentArrayId(const std::string& name)
+  {
+    auto it = componentArrayIds_.find(name);
+
+    return it == componentArrayIds_.end() ? INVALID_COMPONENT_ID : it->second;
+  }
+
+  unsigned ComponentFactory::GetTagId(const std::string& tag)
+  {
+    auto it = tagIds_.find(tag);
+
+    return it == tagIds_.end() ? INVALID_COMPONENT_ID : it->second;
+  }
+
+  const std::string& ComponentFactory::GetComponentArrayName(unsigned id)
+  {
+    return componentArrayList_.at(id);
+  }
+
+  unsigned ComponentFactory::GetComponentCount()
+  {
+    return static_cast<unsigned>(componentIds_.size());
+  }
+
+  unsigned ComponentFactory::GetComponentArrayCount()
+  {
+    return static_cast<unsigned>(componentArrayIds_.size());
+  }
 }
\ No newline at end of file
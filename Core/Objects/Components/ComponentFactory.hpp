@@ -17,7 +17,8 @@
 
 #include "Objects/Components/Component.hpp"
 #include "Objects/Components/ComponentArray.hpp"
-#include "Objects/Pools/Pool.hpp"
+#include "Utilities/Utilities.hpp"
+#include <climits>
 
 namespace Barrage
 {
@@ -29,6 +30,11 @@ namespace Barrage
   using ComponentFactoryMethodMap = std::map<std::string, ComponentFactoryMethod>;
   using ComponentArrayFactoryMethodMap = std::map<std::string, ComponentArrayFactoryMethod>;
 
+  using ComponentIdMap = std::map<std::string, unsigned>;
+
+  constexpr unsigned INVALID_COMPONENT_ID = UINT_MAX;   //!< ID of any component, component array, or tag that hasn't been registered
+  constexpr unsigned MAX_REGISTERED_COMPONENTS = 64;    //!< Max number of registered components (and separately, component arrays and tags)
+
   //! Responsible for allocating new components
   class ComponentFactory
   {
@@ -68,7 +74,8 @@ namespace Barrage
       /**************************************************************/
       /*!
         \brief
-          Tells the allocator that a given tag exists in the engine.
+          Tells the allocator that a given tag exists in the engine,
+          and assigns the tag an ID.
 
         \param tag
           The tag to register.
@@ -154,6 +161,127 @@ namespace Barrage
       /**************************************************************/
       static const StringSet& GetTagNames();
 
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the ID assigned to a component when it was registered.
+          IDs are dense, starting at 0, so they can index into a
+          table sized by GetComponentCount().
+
+        \param name
+          The name of the component.
+
+        \return
+          Returns the component's ID if it has been registered,
+          otherwise returns INVALID_COMPONENT_ID.
+      */
+      /**************************************************************/
+      static unsigned GetComponentId(const std::string& name);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the ID assigned to a component array when it was
+          registered. IDs are dense, starting at 0, so they can index
+          into a table sized by GetComponentArrayCount().
+
+        \param name
+          The name of the component array.
+
+        \return
+          Returns the component array's ID if it has been registered,
+          otherwise returns INVALID_COMPONENT_ID.
+      */
+      /**************************************************************/
+      static unsigned GetComponentArrayId(const std::string& name);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the ID assigned to a tag when it was registered.
+
+        \param tag
+          The tag.
+
+        \return
+          Returns the tag's ID if it has been registered, otherwise
+          returns INVALID_COMPONENT_ID.
+      */
+      /**************************************************************/
+      static unsigned GetTagId(const std::string& tag);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the ID assigned to a component type when it was
+          registered. The ID is resolved once at registration, so
+          this is just a load of a static variable.
+
+        \tparam T
+          The type of data the component wraps.
+
+        \return
+          Returns the component's ID if it has been registered,
+          otherwise returns INVALID_COMPONENT_ID.
+      */
+      /**************************************************************/
+      template <typename T>
+      static unsigned GetComponentId();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the ID assigned to a component array type when it was
+          registered. The ID is resolved once at registration, so
+          this is just a load of a static variable.
+
+        \tparam T
+          The type of component the array contains.
+
+        \return
+          Returns the component array's ID if it has been
+          registered, otherwise returns INVALID_COMPONENT_ID.
+      */
+      /**************************************************************/
+      template <typename T>
+      static unsigned GetComponentArrayId();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the name of the component array with the given ID.
+
+        \param id
+          The ID of the component array (must be valid).
+
+        \return
+          Returns the name of the component array.
+      */
+      /**************************************************************/
+      static const std::string& GetComponentArrayName(unsigned id);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of registered components.
+
+        \return
+          Returns the number of registered components.
+      */
+      /**************************************************************/
+      static unsigned GetComponentCount();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of registered component arrays.
+
+        \return
+          Returns the number of registered component arrays.
+      */
+      /**************************************************************/
+      static unsigned GetComponentArrayCount();
+
     private:
       ComponentFactory() = delete;
       ComponentFactory(const ComponentFactory&) = delete;
@@ -200,12 +328,31 @@ namespace Barrage
       static DeepPtr<ComponentArray> AllocateComponentArray(unsigned capacity);
 
     private:
+      //! Holds the ID of a registered component type
+      template <typename T>
+      struct ComponentTypeId
+      {
+        static unsigned id_;
+      };
+
+      //! Holds the ID of a registered component array type
+      template <typename T>
+      struct ComponentArrayTypeId
+      {
+        static unsigned id_;
+      };
+
       static ComponentFactoryMethodMap componentFactoryMethodMap_;           //!< Maps names of shared components to their allocation functions
       static ComponentArrayFactoryMethodMap componentArrayFactoryMethodMap_; //!< Maps names of component arrays to their allocation functions
 
       static StringSet componentNames_;      //!< Names of all components registered with the engine
       static StringSet componentArrayNames_; //!< Names of all component arrays registered with the engine
       static StringSet tagNames_;            //!< Names of all tags registered with the engine
+
+      static ComponentIdMap componentIds_;                  //!< Maps names of components to their IDs
+      static ComponentIdMap componentArrayIds_;             //!< Maps names of component arrays to their IDs
+      static ComponentIdMap tagIds_;                        //!< Maps tags to their IDs
+      static std::vector<std::string> componentArrayList_;  //!< Names of component arrays, indexed by ID
   };
 }
 
@@ -15,8 +15,16 @@
 #define ComponentFactory_BARRAGE_T
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <stdexcept>
+
 namespace Barrage
 {
+  template <typename T>
+  unsigned ComponentFactory::ComponentTypeId<T>::id_ = INVALID_COMPONENT_ID;
+
+  template <typename T>
+  unsigned ComponentFactory::ComponentArrayTypeId<T>::id_ = INVALID_COMPONENT_ID;
+
   template <typename T>
   void ComponentFactory::RegisterComponent(const std::string& componentName)
   {
@@ -25,8 +33,17 @@ namespace Barrage
       return;
     }
 
+    unsigned id = static_cast<unsigned>(componentIds_.size());
+
+    if (id >= MAX_REGISTERED_COMPONENTS)
+    {
+      throw std::runtime_error("Could not register component \"" + componentName + "\" (too many components registered).");
+    }
+
     componentNames_.insert(componentName);
     componentFactoryMethodMap_[componentName] = &ComponentFactory::AllocateComponent<T>;
+    componentIds_[componentName] = id;
+    ComponentTypeId<T>::id_ = id;
   }
 
   template <typename T>
@@ -37,8 +54,30 @@ namespace Barrage
       return;
     }
 
+    unsigned id = static_cast<unsigned>(componentArrayIds_.size());
+
+    if (id >= MAX_REGISTERED_COMPONENTS)
+    {
+      throw std::runtime_error("Could not register component array \"" + componentName + "\" (too many component arrays registered).");
+    }
+
     componentArrayNames_.insert(componentName);
     componentArrayFactoryMethodMap_[componentName] = &ComponentFactory::AllocateComponentArray<T>;
+    componentArrayIds_[componentName] = id;
+    componentArrayList_.push_back(componentName);
+    ComponentArrayTypeId<T>::id_ = id;
+  }
+
+  template <typename T>
+  unsigned ComponentFactory::GetComponentId()
+  {
+    return ComponentTypeId<T>::id_;
+  }
+
+  template <typename T>
+  unsigned ComponentFactory::GetComponentArrayId()
+  {
+    return ComponentArrayTypeId<T>::id_;
   }
 
   template <typename T>
@@ -57,7 +96,7 @@ namespace Barrage
   template <typename T>
   DeepPtr<ComponentArray> ComponentFactory::AllocateComponentArray(unsigned capacity)
   {
-    return DeepPtr<ComponentArray>(std::make_shared<ComponentArrayT<T>>(capacity));
+    return DeepPtr<ComponentArray>(std::make_shared<ComponentArrayType<T>>(capacity));
   }
 }
 
@@ -0,0 +1,95 @@
+/* ======================================================================== */
+/*!
+ * \file            DestructionPlan.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A destruction plan describes how to pack a pool's surviving objects
+   after some of them are destroyed. It's built once from the pool's
+   destruction flags, then applied to every component array and every
+   piece of per-object component data.
+ */
+ /* ======================================================================== */
+
+#include "stdafx.h"
+#include "DestructionPlan.hpp"
+#include "Utilities/Utilities.hpp"
+
+#include <algorithm>
+
+namespace Barrage
+{
+  DestructionPlan::DestructionPlan() :
+    moves_(),
+    numAliveObjects_(0),
+    endIndex_(0)
+  {
+  }
+
+  void DestructionPlan::Build(const uint64_t* destroyedBits, unsigned writeIndex, unsigned endIndex)
+  {
+    moves_.clear();
+    endIndex_ = endIndex;
+
+    unsigned readIndex = writeIndex + 1;
+
+    while (readIndex < endIndex)
+    {
+      // skip the dead objects
+      readIndex = FindNextBit(destroyedBits, readIndex, endIndex, false);
+
+      unsigned runBegin = readIndex;
+
+      // find the end of the alive run
+      readIndex = FindNextBit(destroyedBits, readIndex, endIndex, true);
+
+      unsigned runLength = readIndex - runBegin;
+
+      if (runLength)
+      {
+        moves_.push_back({ runBegin, writeIndex, runLength });
+        writeIndex += runLength;
+      }
+    }
+
+    // now that the plan packs the pool, the number of alive objects is the same as the next write index
+    numAliveObjects_ = writeIndex;
+  }
+
+  void DestructionPlan::BuildUnordered(const uint64_t* destroyedBits, unsigned writeIndex, unsigned endIndex)
+  {
+    moves_.clear();
+    endIndex_ = endIndex;
+
+    // everything below writeIndex is alive and in place, everything at or above endIndex is dead or already moved
+    while (writeIndex < endIndex)
+    {
+      // drop the dead objects at the end of the pool
+      endIndex = FindPreviousBit(destroyedBits, writeIndex, endIndex, false);
+
+      if (endIndex <= writeIndex)
+      {
+        break;
+      }
+
+      // measure the hole of dead objects at the write index
+      unsigned holeEnd = FindNextBit(destroyedBits, writeIndex, endIndex, false);
+
+      // measure the run of alive objects at the end of the pool
+      unsigned runBegin = FindPreviousBit(destroyedBits, holeEnd, endIndex - 1, true);
+
+      unsigned count = std::min(holeEnd - writeIndex, endIndex - runBegin);
+
+      moves_.push_back({ endIndex - count, writeIndex, count });
+      writeIndex += count;
+      endIndex -= count;
+
+      // skip to the next hole
+      writeIndex = FindNextBit(destroyedBits, writeIndex, endIndex, true);
+    }
+
+    numAliveObjects_ = writeIndex;
+  }
+}
@@ -0,0 +1,97 @@
+/* ======================================================================== */
+/*!
+ * \file            DestructionPlan.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A destruction plan describes how to pack a pool's surviving objects
+   after some of them are destroyed. It's built once from the pool's
+   destruction flags, then applied to every component array and every
+   piece of per-object component data.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef DestructionPlan_BARRAGE_H
+#define DestructionPlan_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+
+namespace Barrage
+{
+  //! Moves a contiguous block of objects to another spot in the same pool
+  struct ObjectMove
+  {
+    unsigned sourceIndex_;    //!< Index of the first object to move
+    unsigned recipientIndex_; //!< Index the first object is moved to
+    unsigned count_;          //!< Number of objects to move
+  };
+
+  //! Moves that pack a pool's alive objects after destructions
+  class DestructionPlan
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs an empty plan.
+      */
+      /**************************************************************/
+      DestructionPlan();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Scans the destruction bits once and records each run of
+          alive objects as a single move, packing the alive objects
+          at the front of the pool in their original order. Runs are
+          found a word (64 objects) at a time.
+
+        \param destroyedBits
+          Bitset with one bit per object, set if the object at that
+          index is destroyed (bit i % 64 of word i / 64).
+
+        \param writeIndex
+          The index of the first dead object.
+
+        \param endIndex
+          One past the index of the last object that could be alive.
+      */
+      /**************************************************************/
+      void Build(const uint64_t* destroyedBits, unsigned writeIndex, unsigned endIndex);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Builds a plan that fills each run of dead objects with
+          alive objects taken from the end of the pool. Only as many
+          objects as were destroyed get moved, but alive objects
+          don't keep their relative order.
+
+        \param destroyedBits
+          Bitset with one bit per object, set if the object at that
+          index is destroyed (bit i % 64 of word i / 64).
+
+        \param writeIndex
+          The index of the first dead object.
+
+        \param endIndex
+          One past the index of the last object that could be alive.
+      */
+      /**************************************************************/
+      void BuildUnordered(const uint64_t* destroyedBits, unsigned writeIndex, unsigned endIndex);
+
+    public:
+      std::vector<ObjectMove> moves_; //!< Moves to apply, in order
+      unsigned numAliveObjects_;      //!< Number of alive objects once the moves are applied
+      unsigned endIndex_;             //!< One past the index of the last object that could have been alive
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // DestructionPlan_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,345 @@
+/* ======================================================================== */
+/*!
+ * \file            SplitComponentArray.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A component array that stores each field of its component in a separate
+   stream (struct of arrays). Systems that only need some of a component's
+   fields can walk contiguous float streams instead of whole structs.
+
+   A component opts in by specializing ComponentFields (to describe its
+   fields) and ComponentArrayStorage (to select this array type). Single
+   components are still read and written as whole structs, so RTTR,
+   serialization, and the editor work the same as with ComponentArrayT.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SplitComponentArray_BARRAGE_H
+#define SplitComponentArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Components/ComponentArray.hpp"
+
+namespace Barrage
+{
+  /****************************************************************************/
+  /*!
+    \brief
+      Describes how a component is split into float streams. Specializations
+      must provide:
+
+        NUM_FIELDS
+          A constant holding the number of streams the component is
+          split into.
+
+        static void Write(const T& value, float* const* fields, unsigned index);
+          Writes a component to slot "index" of each stream.
+
+        static T Read(const float* const* fields, unsigned index);
+          Reads a component from slot "index" of each stream.
+
+    \tparam T
+      The component type being described.
+  */
+  /****************************************************************************/
+  template <typename T>
+  struct ComponentFields;
+
+  //! Component array that stores each of its component's fields in a separate stream
+  template <typename T>
+  class SplitComponentArrayT : public ComponentArray
+  {
+    public:
+      static constexpr unsigned NUM_FIELDS = ComponentFields<T>::NUM_FIELDS; //!< Number of streams per component
+
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs a component array with the given capacity. Every
+          slot holds a default constructed component.
+
+        \param capacity
+          The number of components held in the array.
+      */
+      /**************************************************************/
+      SplitComponentArrayT(unsigned capacity = 1);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copy constructor.
+
+        \param other
+          The array to copy.
+      */
+      /**************************************************************/
+      SplitComponentArrayT(const SplitComponentArrayT<T>& other);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copy assignment operator.
+
+        \param other
+          The array to copy.
+      */
+      /**************************************************************/
+      SplitComponentArrayT<T>& operator=(const SplitComponentArrayT<T>& other);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Deallocates component array.
+      */
+      /**************************************************************/
+      ~SplitComponentArrayT() override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Creates a component array that's a deep copy of this one.
+
+        \return
+          Returns a pointer to the new component array.
+      */
+      /**************************************************************/
+      std::shared_ptr<ComponentArray> Clone() const override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies a component from some source component array to a
+          recipient component in this component array. The arrays
+          should be the same type (this function is not safety
+          checked).
+
+        \param source
+          The component array holding the component to copy from. The
+          source may be this component array.
+
+        \param sourceIndex
+          The index of the component to copy from.
+
+        \param recipientIndex
+          The index of the component in this component array to copy
+          to.
+      */
+      /**************************************************************/
+      void CopyToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies a single component from some source component array
+          to every component in the range
+          [recipientIndex, recipientIndex + count) of this array. The
+          arrays should be the same type (this function is not safety
+          checked).
+
+        \param source
+          The component array holding the component to copy from. The
+          source may be this component array.
+
+        \param sourceIndex
+          The index of the component to copy from.
+
+        \param recipientIndex
+          The index of the first component in this array to copy to.
+
+        \param count
+          The number of components to write.
+      */
+      /**************************************************************/
+      void FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies the range [sourceIndex, sourceIndex + count) of some
+          source component array to the range
+          [recipientIndex, recipientIndex + count) of this array. The
+          arrays should be the same type (this function is not safety
+          checked). Each stream is copied with a single memmove.
+
+        \param source
+          The component array holding the components to copy from.
+          The source may be this component array, and the ranges may
+          overlap.
+
+        \param sourceIndex
+          The index of the first component to copy from.
+
+        \param recipientIndex
+          The index of the first component in this array to copy to.
+
+        \param count
+          The number of components to copy.
+      */
+      /**************************************************************/
+      void CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reallocates the streams with a new capacity. The first
+          numObjects components are kept; the rest of the slots are
+          left uninitialized until objects are spawned into them.
+
+        \param capacity
+          The new capacity to set.
+
+        \param numObjects
+          The number of objects whose data should be kept.
+      */
+      /**************************************************************/
+      void SetCapacity(unsigned capacity, unsigned numObjects) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Applies a destruction plan to the array, tightly packing
+          the remaining alive objects at the beginning of the array.
+
+        \param plan
+          The moves that pack the pool's alive objects, built once
+          from the pool's destruction flags.
+      */
+      /**************************************************************/
+      void HandleDestructions(const DestructionPlan& plan) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reads the component at a given index in the array.
+
+        \param index
+          The index of the component to read.
+
+        \return
+          Returns a copy of the component.
+      */
+      /**************************************************************/
+      T Get(unsigned index) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Writes the component at a given index in the array.
+
+        \param index
+          The index of the component to write.
+
+        \param value
+          The value to write.
+      */
+      /**************************************************************/
+      void Set(unsigned index, const T& value);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets one of the array's streams. Each stream is aligned to
+          COMPONENT_ARRAY_ALIGNMENT.
+
+        \param field
+          The field whose stream to get (see ComponentFields<T>).
+
+        \return
+          Returns a pointer to the first element of the stream.
+      */
+      /**************************************************************/
+      float* GetField(unsigned field);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets one of the array's streams. Each stream is aligned to
+          COMPONENT_ARRAY_ALIGNMENT.
+
+        \param field
+          The field whose stream to get (see ComponentFields<T>).
+
+        \return
+          Returns a pointer to the first element of the stream.
+      */
+      /**************************************************************/
+      const float* GetField(unsigned field) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets an rttr::variant representation of the component at
+          some index. Should not generally be used except for
+          serialization/the editor.
+
+        \param index
+          The index of the component to get.
+
+        \return
+          Returns the value of the component as an rttr::variant.
+      */
+      /**************************************************************/
+      rttr::variant GetRTTRValue(int index) const override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets the component value at some index using an rttr::variant.
+          Should not generally be used except for serialization or
+          the editor.
+      */
+      /**************************************************************/
+      void SetRTTRValue(const rttr::variant& value, int index) override;
+
+    private:
+      /**************************************************************/
+      /*!
+        \brief
+          Allocates a single block holding every stream for a given
+          capacity and points fields_ into it.
+
+        \param capacity
+          The number of components each stream should fit.
+      */
+      /**************************************************************/
+      void Allocate(unsigned capacity);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Frees the block holding the streams.
+      */
+      /**************************************************************/
+      void Deallocate();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of floats between the starts of two
+          streams for a given capacity (rounded up so every stream
+          starts on an aligned boundary).
+
+        \param capacity
+          The number of components each stream should fit.
+
+        \return
+          Returns the stream stride.
+      */
+      /**************************************************************/
+      static unsigned GetStride(unsigned capacity);
+
+    private:
+      float* fields_[NUM_FIELDS]; //!< Start of each field's stream (all streams live in one block)
+      unsigned size_;             //!< Number of slots at the start of each stream that have been written
+  };
+}
+
+#include "SplitComponentArray.tpp"
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SplitComponentArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
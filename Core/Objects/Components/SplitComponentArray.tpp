@@ -0,0 +1,240 @@
+/* ======================================================================== */
+/*!
+ * \file            SplitComponentArray.tpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A component array that stores each field of its component in a separate
+   stream (struct of arrays). Systems that only need some of a component's
+   fields can walk contiguous float streams instead of whole structs.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SplitComponentArray_BARRAGE_T
+#define SplitComponentArray_BARRAGE_T
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace Barrage
+{
+  template <typename T>
+  SplitComponentArrayT<T>::SplitComponentArrayT(unsigned capacity) :
+    ComponentArray(capacity),
+    fields_(),
+    size_(capacity)
+  {
+    Allocate(capacity);
+
+    const T value = T();
+
+    for (unsigned i = 0; i < capacity; ++i)
+    {
+      ComponentFields<T>::Write(value, fields_, i);
+    }
+  }
+
+  template <typename T>
+  SplitComponentArrayT<T>::SplitComponentArrayT(const SplitComponentArrayT<T>& other) :
+    ComponentArray(other.capacity_),
+    fields_(),
+    size_(other.size_)
+  {
+    Allocate(capacity_);
+
+    // slots past size_ were never written, so there's nothing to copy there
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      std::memcpy(fields_[field], other.fields_[field], size_ * sizeof(float));
+    }
+  }
+
+  template <typename T>
+  SplitComponentArrayT<T>& SplitComponentArrayT<T>::operator=(const SplitComponentArrayT<T>& other)
+  {
+    if (this == &other)
+    {
+      return *this;
+    }
+
+    SetCapacity(other.capacity_, 0);
+
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      std::memcpy(fields_[field], other.fields_[field], other.size_ * sizeof(float));
+    }
+
+    size_ = other.size_;
+
+    return *this;
+  }
+
+  template <typename T>
+  SplitComponentArrayT<T>::~SplitComponentArrayT()
+  {
+    Deallocate();
+  }
+
+  template <typename T>
+  std::shared_ptr<ComponentArray> SplitComponentArrayT<T>::Clone() const
+  {
+    return std::make_shared<SplitComponentArrayT<T>>(*this);
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::CopyToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex)
+  {
+    const SplitComponentArrayT<T>& source_derived = static_cast<const SplitComponentArrayT<T>&>(source);
+
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      fields_[field][recipientIndex] = source_derived.fields_[field][sourceIndex];
+    }
+
+    size_ = std::max(size_, recipientIndex + 1);
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count)
+  {
+    const SplitComponentArrayT<T>& source_derived = static_cast<const SplitComponentArrayT<T>&>(source);
+
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      // read the value first in case it lives inside the range being filled
+      const float value = source_derived.fields_[field][sourceIndex];
+
+      std::fill_n(fields_[field] + recipientIndex, count, value);
+    }
+
+    size_ = std::max(size_, recipientIndex + count);
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count)
+  {
+    const SplitComponentArrayT<T>& source_derived = static_cast<const SplitComponentArrayT<T>&>(source);
+
+    if (count == 0 || (&source_derived == this && sourceIndex == recipientIndex))
+    {
+      return;
+    }
+
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      std::memmove(fields_[field] + recipientIndex, source_derived.fields_[field] + sourceIndex, count * sizeof(float));
+    }
+
+    size_ = std::max(size_, recipientIndex + count);
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::SetCapacity(unsigned capacity, unsigned numObjects)
+  {
+    float* oldFields[NUM_FIELDS];
+    unsigned numKept = std::min(numObjects, std::min(capacity, size_));
+
+    std::copy(fields_, fields_ + NUM_FIELDS, oldFields);
+
+    Allocate(capacity);
+
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      std::memcpy(fields_[field], oldFields[field], numKept * sizeof(float));
+    }
+
+    ::operator delete(oldFields[0], std::align_val_t(COMPONENT_ARRAY_ALIGNMENT));
+
+    size_ = numKept;
+    capacity_ = capacity;
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::HandleDestructions(const DestructionPlan& plan)
+  {
+    for (const ObjectMove& move : plan.moves_)
+    {
+      SplitComponentArrayT<T>::CopyRangeToThis(*this, move.sourceIndex_, move.recipientIndex_, move.count_);
+    }
+  }
+
+  template <typename T>
+  T SplitComponentArrayT<T>::Get(unsigned index) const
+  {
+    return ComponentFields<T>::Read(fields_, index);
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::Set(unsigned index, const T& value)
+  {
+    ComponentFields<T>::Write(value, fields_, index);
+
+    size_ = std::max(size_, index + 1);
+  }
+
+  template <typename T>
+  float* SplitComponentArrayT<T>::GetField(unsigned field)
+  {
+    return fields_[field];
+  }
+
+  template <typename T>
+  const float* SplitComponentArrayT<T>::GetField(unsigned field) const
+  {
+    return fields_[field];
+  }
+
+  template <typename T>
+  rttr::variant SplitComponentArrayT<T>::GetRTTRValue(int index) const
+  {
+    rttr::variant value = Get(index);
+
+    return value;
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::SetRTTRValue(const rttr::variant& value, int index)
+  {
+    if (value.get_type() != rttr::type::get<T>())
+    {
+      return;
+    }
+
+    Set(index, value.get_value<T>());
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::Allocate(unsigned capacity)
+  {
+    unsigned stride = GetStride(capacity);
+    float* block = static_cast<float*>(::operator new(NUM_FIELDS * stride * sizeof(float), std::align_val_t(COMPONENT_ARRAY_ALIGNMENT)));
+
+    for (unsigned field = 0; field < NUM_FIELDS; ++field)
+    {
+      fields_[field] = block + field * stride;
+    }
+  }
+
+  template <typename T>
+  void SplitComponentArrayT<T>::Deallocate()
+  {
+    ::operator delete(fields_[0], std::align_val_t(COMPONENT_ARRAY_ALIGNMENT));
+  }
+
+  template <typename T>
+  unsigned SplitComponentArrayT<T>::GetStride(unsigned capacity)
+  {
+    const unsigned floatsPerLine = COMPONENT_ARRAY_ALIGNMENT / sizeof(float);
+
+    return (capacity + floatsPerLine - 1) / floatsPerLine * floatsPerLine;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SplitComponentArray_BARRAGE_T
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -15,43 +15,82 @@
 #include "Pool.hpp"
 #include "Objects/Components/ComponentFactory.hpp"
 #include "Objects/Spawning/SpawnType.hpp"
+#include "Spaces/Space.hpp"
 
 namespace Barrage
 {
   Pool::Pool(const PoolArchetype& archetype) :
-    components_(archetype.components_),
-    componentArrays_(),
+    components_(ComponentFactory::GetComponentCount()),
+    componentArrays_(ComponentFactory::GetComponentArrayCount()),
     tags_(archetype.tags_),
-    spawnArchetypes_(archetype.spawnArchetypes_),
+    signature_(),
+    spawnArchetypes_(),
+    destructionPlan_(),
+    unorderedDestruction_(archetype.unorderedDestruction_),
     numActiveObjects_(0),
     numQueuedObjects_(0),
+    numSpawnedObjects_(0),
     capacity_(archetype.capacity_),
+    maxCapacity_(archetype.maxCapacity_),
+    numDroppedSpawns_(0),
+    numGrowths_(0),
     name_(archetype.name_)
   {
-    for (auto& component : components_)
+    for (const auto& pair : archetype.components_)
     {
-      component.second->SetCapacity(capacity_);
+      unsigned id = ComponentFactory::GetComponentId(pair.first);
+
+      if (id == INVALID_COMPONENT_ID || !pair.second)
+      {
+        throw std::runtime_error("Pool \"" + name_ + "\" has unregistered component \"" + pair.first + "\".");
+      }
+
+      components_[id] = pair.second;
+      components_[id]->SetCapacity(capacity_, 0);
+      signature_.AddComponent(id);
     }
     
     for (const auto& componentArrayName : archetype.componentArrayNames_)
     {
-      DeepPtr<ComponentArray> componentArray = ComponentFactory::AllocateComponentArray(componentArrayName, capacity_);
+      unsigned id = ComponentFactory::GetComponentArrayId(componentArrayName);
+
+      if (id == INVALID_COMPONENT_ID)
+      {
+        throw std::runtime_error("Pool \"" + name_ + "\" has unregistered component array \"" + componentArrayName + "\".");
+      }
+
+      // allocate empty, then reserve uninitialized storage; components are constructed as objects spawn
+      componentArrays_[id] = ComponentFactory::AllocateComponentArray(componentArrayName, 0);
+      componentArrays_[id]->SetCapacity(capacity_, 0);
+      signature_.AddComponentArray(id);
+    }
+
+    for (const auto& tag : tags_)
+    {
+      unsigned id = ComponentFactory::GetTagId(tag);
 
-      // TODO: Log/throw something if these conditions aren't met
-      if (componentArray && componentArrays_.count(componentArrayName) == 0)
+      if (id != INVALID_COMPONENT_ID)
       {
-        componentArrays_.emplace(componentArrayName, componentArray);
+        signature_.AddTag(id);
       }
     }
 
+    for (const auto& pair : archetype.spawnArchetypes_)
+    {
+      spawnArchetypes_.emplace(pair.first, MakeArchetypeTable(pair.second));
+    }
+
     for (const auto& pair : archetype.startingObjects_)
     {
-      // TODO: Log/throw something if this condition isn't met
-      if (GetAvailableSlots())
+      Grow(GetSpawnIndex() + 1);
+
+      if (!GetAvailableSlots())
       {
-        CreateObjectsUnsafe(pair.second, 1);
-        numActiveObjects_++;
+        throw std::runtime_error("Pool \"" + name_ + "\" has more starting objects than its max capacity.");
       }
+
+      CreateObjectsUnsafe(MakeArchetypeTable(pair.second), 1);
+      numActiveObjects_++;
     }
   }
 
@@ -65,19 +104,46 @@ namespace Barrage
     return capacity_;
   }
 
+  unsigned Pool::DroppedSpawnCount() const
+  {
+    return numDroppedSpawns_;
+  }
+
+  unsigned Pool::GrowthCount() const
+  {
+    return numGrowths_;
+  }
+
   void Pool::QueueSpawns(Space& space, Pool& sourcePool, SpawnType& spawnType)
   {
     spawnType.FinalizeGroupInfo();
+
+    unsigned numRequestedObjects = spawnType.GetSpawnSize();
+
+    if (numRequestedObjects > GetAvailableSlots())
+    {
+      Grow(GetSpawnIndex() + numRequestedObjects);
+    }
     
     unsigned numObjects = spawnType.FinalizeSpawnSize(GetAvailableSlots());
 
+    numDroppedSpawns_ += numRequestedObjects - numObjects;
+
     if (numObjects != 0)
     {
-      ObjectArchetype& spawnArchetype = spawnArchetypes_.at(spawnType.spawnArchetype_);
+      ComponentArrayTable& spawnArchetype = spawnArchetypes_.at(spawnType.spawnArchetype_);
       CreateObjectsUnsafe(spawnArchetype, numObjects);
 
-      ApplyValueSpawnRules(space, sourcePool, spawnType);
-      ApplyCountSpawnRules(space, sourcePool, spawnType);
+      if (!spawnType.IsCompiled())
+      {
+        spawnType.Compile();
+      }
+
+      // value rules take the first random ids, and count rules the ids after them
+      unsigned randomId = spawnType.NextRandomId(space.GetTick());
+
+      ApplyValueSpawnRules(space, sourcePool, spawnType, randomId);
+      ApplyCountSpawnRules(space, sourcePool, spawnType, randomId + static_cast<unsigned>(spawnType.valueOps_.size()));
 
       numQueuedObjects_ += numObjects;
 
@@ -88,17 +154,22 @@ namespace Barrage
   void Pool::SpawnObjects()
   {
     numActiveObjects_ += numQueuedObjects_;
+    numSpawnedObjects_ = numQueuedObjects_;
     numQueuedObjects_ = 0;
   }
 
   bool Pool::HasComponent(const std::string& componentName)
   {
-    return components_.count(componentName);
+    unsigned id = ComponentFactory::GetComponentId(componentName);
+    
+    return id < components_.size() && components_[id];
   }
 
   bool Pool::HasComponentArray(const std::string& componentArrayName)
   {
-    return componentArrays_.count(componentArrayName);
+    unsigned id = ComponentFactory::GetComponentArrayId(componentArrayName);
+
+    return id < componentArrays_.size() && componentArrays_[id];
   }
 
   bool Pool::HasTag(const std::string& tag) const
@@ -116,40 +187,124 @@ namespace Barrage
     return numActiveObjects_ + numQueuedObjects_;
   }
 
-  void Pool::CreateObjectsUnsafe(const ObjectArchetype& archetype, unsigned numObjects)
+  void Pool::Grow(unsigned minCapacity)
   {
-    unsigned startIndex = GetSpawnIndex();
-    
+    if (capacity_ >= maxCapacity_ || capacity_ >= minCapacity)
+    {
+      return;
+    }
+
+    unsigned newCapacity = capacity_ ? capacity_ : 1;
+
+    while (newCapacity < minCapacity && newCapacity < maxCapacity_)
+    {
+      newCapacity *= 2;
+    }
+
+    if (newCapacity > maxCapacity_)
+    {
+      newCapacity = maxCapacity_;
+    }
+
+    unsigned numObjects = GetSpawnIndex();
+
+    for (auto it = components_.begin(); it != components_.end(); ++it)
+    {
+      if (*it)
+      {
+        (*it)->SetCapacity(newCapacity, numObjects);
+      }
+    }
+
     for (auto it = componentArrays_.begin(); it != componentArrays_.end(); ++it)
     {
-      DeepPtr<ComponentArray>& destination_array = it->second;
-      const DeepPtr<ComponentArray>& source_component = archetype.componentArrays_.at(it->first);
+      if (*it)
+      {
+        (*it)->SetCapacity(newCapacity, numObjects);
+      }
+    }
+
+    capacity_ = newCapacity;
+    numGrowths_++;
+  }
 
-      for (unsigned i = 0; i < numObjects; ++i)
+  ComponentArrayTable Pool::MakeArchetypeTable(const ObjectArchetype& archetype) const
+  {
+    ComponentArrayTable table = archetype.GetComponentArrayTable();
+
+    // objects are copied array by array, so an archetype needs every array the pool has
+    for (unsigned id = 0; id < componentArrays_.size(); ++id)
+    {
+      if (componentArrays_[id] && !table[id])
       {
-        destination_array->CopyToThis(*source_component, 0, startIndex + i);
+        throw std::runtime_error("Object \"" + archetype.name_ + "\" in pool \"" + name_ + "\" is missing component array \"" + ComponentFactory::GetComponentArrayName(id) + "\".");
       }
     }
+
+    return table;
   }
 
-  void Pool::ApplyValueSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType)
+  void Pool::CreateObjectsUnsafe(const ComponentArrayTable& archetype, unsigned numObjects)
   {
     unsigned startIndex = GetSpawnIndex();
     
-    for (auto it = spawnType.spawnLayers_.begin(); it != spawnType.spawnLayers_.end(); ++it)
+    for (unsigned id = 0; id < componentArrays_.size(); ++id)
     {
-      SpawnLayer& spawnLayer = *it;
+      DeepPtr<ComponentArray>& destination_array = componentArrays_[id];
 
-      for (auto jt = spawnLayer.valueRules_.begin(); jt != spawnLayer.valueRules_.end(); ++jt)
+      if (!destination_array)
       {
-        DeepPtr<SpawnRule>& spawnRule = *jt;
+        continue;
+      }
+
+      destination_array->FillToThis(*archetype[id], 0, startIndex, numObjects);
+    }
+  }
+
+  void Pool::ApplyValueSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType, unsigned randomId)
+  {
+    std::vector<unsigned>& sourceIndices = spawnType.sourceIndices_;
+    std::vector<unsigned>& tileSourceIndices = spawnType.tileSourceIndices_;
+    unsigned startIndex = GetSpawnIndex();
+    size_t nextSource = 0;
+
+    // every rule runs on one tile of spawners before the next tile starts,
+    // so each new object is still in cache when the later rules reach it
+    while (nextSource < sourceIndices.size())
+    {
+      unsigned tileSize = 0;
+
+      tileSourceIndices.clear();
+
+      // a spawner bigger than a tile gets a tile to itself
+      while (nextSource < sourceIndices.size())
+      {
+        unsigned spawnSize = spawnType.GetSpawnSize(sourceIndices[nextSource]);
+
+        if (!tileSourceIndices.empty() && tileSize + spawnSize > SpawnType::TILE_SIZE)
+        {
+          break;
+        }
 
-        spawnRule->ExecuteFull(sourcePool, *this, space, startIndex, spawnType.sourceIndices_, spawnLayer.groupInfoArray_);
+        tileSize += spawnSize;
+        tileSourceIndices.push_back(sourceIndices[nextSource]);
+        ++nextSource;
       }
+
+      for (unsigned op = 0; op < spawnType.valueOps_.size(); ++op)
+      {
+        SpawnOp& spawnOp = spawnType.valueOps_[op];
+        SpawnLayer& spawnLayer = spawnType.spawnLayers_[spawnOp.layer_];
+        SpawnRuleBatchInfo info(sourcePool, *this, space, startIndex, tileSourceIndices, spawnLayer.groupInfoArray_, randomId + op);
+
+        spawnLayer.valueRules_[spawnOp.rule_]->ExecuteBatch(info);
+      }
+
+      startIndex += tileSize;
     }
   }
 
-  void Pool::ApplyCountSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType)
+  void Pool::ApplyCountSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType, unsigned randomId)
   {
     unsigned startIndex = GetSpawnIndex();
 
@@ -160,8 +315,9 @@ namespace Barrage
       for (auto jt = spawnLayer.countRules_.begin(); jt != spawnLayer.countRules_.end(); ++jt)
       {
         DeepPtr<SpawnRule>& spawnRule = *jt;
+        SpawnRuleBatchInfo info(sourcePool, *this, space, startIndex, spawnType.sourceIndices_, spawnLayer.groupInfoArray_, randomId++);
 
-        spawnRule->ExecuteFull(sourcePool, *this, space, startIndex, spawnType.sourceIndices_, spawnLayer.groupInfoArray_);
+        spawnRule->ExecuteBatch(info);
       }
     }
   }
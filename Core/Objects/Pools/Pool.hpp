@@ -19,6 +19,8 @@
 #include "Objects/Archetypes/PoolArchetype.hpp"
 #include "Objects/Components/Component.hpp"
 #include "Objects/Components/ComponentArray.hpp"
+#include "Objects/Components/ComponentFactory.hpp"
+#include "Objects/Pools/PoolSignature.hpp"
 #include "Objects/Spawning/SpawnType.hpp"
 
 namespace Barrage
@@ -60,6 +62,31 @@ namespace Barrage
       /**************************************************************/
       unsigned GetCapacity() const;
 
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of objects that couldn't be spawned because
+          the pool was full (and couldn't grow any further).
+
+        \return
+          Returns the number of dropped spawns since the pool was
+          created.
+      */
+      /**************************************************************/
+      unsigned DroppedSpawnCount() const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the number of times the pool has grown past its
+          starting capacity.
+
+        \return
+          Returns the number of times the pool has grown.
+      */
+      /**************************************************************/
+      unsigned GrowthCount() const;
+
       /**************************************************************/
       /*!
         \brief
@@ -99,7 +126,85 @@ namespace Barrage
       */
       /**************************************************************/
       template <typename T>
-      ComponentArrayT<T>& GetComponentArray(const std::string& componentArrayName);
+      ComponentArrayType<T>& GetComponentArray(const std::string& componentArrayName);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Get a reference to a component by its type. The component's
+          ID is resolved when the type is registered, so this is a
+          single table lookup.
+
+          SAFETY:
+          This function assumes the pool has the component (i.e. the
+          pool matched a pool type requiring it).
+
+        \tparam T
+          The type of component to get.
+
+        \return
+          Returns a reference to the component.
+      */
+      /**************************************************************/
+      template <typename T>
+      ComponentT<T>& GetComponent();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Get a reference to a component array by its type. The
+          array's ID is resolved when the type is registered, so this
+          is a single table lookup.
+
+          SAFETY:
+          This function assumes the pool has the component array
+          (i.e. the pool matched a pool type requiring it).
+
+        \tparam T
+          The type of component array to get.
+
+        \return
+          Returns a reference to the component array.
+      */
+      /**************************************************************/
+      template <typename T>
+      ComponentArrayType<T>& GetComponentArray();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Determines if the pool has a component, by type. Like
+          GetComponent<T>(), this uses the ID resolved when the type
+          was registered, so no names are looked up.
+
+        \tparam T
+          The type of component to check for.
+
+        \return
+          Returns true if the pool has the component, returns
+          false otherwise.
+      */
+      /**************************************************************/
+      template <typename T>
+      bool HasComponent() const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Determines if the pool has a component array, by type. Like
+          GetComponentArray<T>(), this uses the ID resolved when the
+          type was registered, so no names are looked up.
+
+        \tparam T
+          The type of component array to check for.
+
+        \return
+          Returns true if the pool has the component array, returns
+          false otherwise.
+      */
+      /**************************************************************/
+      template <typename T>
+      bool HasComponentArray() const;
 
       /**************************************************************/
       /*!
@@ -122,7 +227,9 @@ namespace Barrage
       /**************************************************************/
       /*!
         \brief
-          Spawns all objects queued for spawn.
+          Spawns all objects queued for spawn. They become the last
+          objects in the pool, and numSpawnedObjects_ is set to how
+          many there were.
       */
       /**************************************************************/
       void SpawnObjects();
@@ -195,6 +302,40 @@ namespace Barrage
       /**************************************************************/
       unsigned GetSpawnIndex() const;
 
+      /**************************************************************/
+      /*!
+        \brief
+          Grows the pool so it can hold at least a given number of
+          objects. Capacity doubles until it's large enough, but never
+          exceeds the pool's max capacity. Objects already in the pool
+          (active and queued) are kept.
+
+          This must only be called before new objects are created for
+          a spawn, since it reallocates every component array.
+
+        \param minCapacity
+          The number of objects the pool should be able to hold.
+      */
+      /**************************************************************/
+      void Grow(unsigned minCapacity);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Indexes an object archetype's component arrays by ID for
+          CreateObjectsUnsafe(). Throws if the archetype is missing
+          one of the pool's component arrays.
+
+        \param archetype
+          The archetype to index.
+
+        \return
+          Returns the archetype's component arrays, indexed by
+          component array ID.
+      */
+      /**************************************************************/
+      ComponentArrayTable MakeArchetypeTable(const ObjectArchetype& archetype) const;
+
       /**************************************************************/
       /*!
         \brief
@@ -202,29 +343,38 @@ namespace Barrage
           object archetype.
 
           SAFETY:
-          This function assumes numObjects <= available slots.
+          This function assumes numObjects <= available slots and
+          that the archetype has every component array the pool has.
 
         \param archetype
-          The archetype used to construct the objects.
+          The archetype's component arrays, indexed by component
+          array ID (see ObjectArchetype::GetComponentArrayTable()).
 
         \param numObjects
           The number of objects to create.
       */
       /**************************************************************/
-      void CreateObjectsUnsafe(const ObjectArchetype& archetype, unsigned numObjects);
+      void CreateObjectsUnsafe(const ComponentArrayTable& archetype, unsigned numObjects);
 
-      void ApplyValueSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType);
+      void ApplyValueSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType, unsigned randomId);
 
-      void ApplyCountSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType);
+      void ApplyCountSpawnRules(Space& space, Pool& sourcePool, SpawnType& spawnType, unsigned randomId);
 
     public:
-      ComponentMap components_;            //!< Holds shared components and their names
-      ComponentArrayMap componentArrays_;  //!< Holds component arrays and their names
+      ComponentTable components_;          //!< Holds shared components, indexed by component ID (nullptr if absent)
+      ComponentArrayTable componentArrays_; //!< Holds component arrays, indexed by component array ID (nullptr if absent)
       StringSet tags_;                     //!< Holds the pool's tags
-      ObjectArchetypeMap spawnArchetypes_; //!< Objects that can be spawned in this pool
+      PoolSignature signature_;            //!< Registered components, component arrays, and tags the pool has
+      std::map<std::string, ComponentArrayTable> spawnArchetypes_; //!< Objects that can be spawned in this pool, with arrays indexed by component array ID
+      DestructionPlan destructionPlan_;    //!< Reused each time destroyed objects are removed from the pool
+      bool unorderedDestruction_;          //!< If true, destroyed objects are replaced by the pool's last objects (spawn order isn't kept)
       unsigned numActiveObjects_;          //!< Number of currently active objects
       unsigned numQueuedObjects_;          //!< Number of objects ready to be spawned on the next tick
+      unsigned numSpawnedObjects_;         //!< Number of objects at the end of the pool activated by the last SpawnObjects() (reset when objects are destroyed)
       unsigned capacity_;                  //!< Total number of objects the pool can hold
+      unsigned maxCapacity_;               //!< Total number of objects the pool may grow to hold
+      unsigned numDroppedSpawns_;          //!< Number of objects that didn't fit in the pool when spawned
+      unsigned numGrowths_;                //!< Number of times the pool has grown
       std::string name_;                   //!< Name of the pool
   };
 
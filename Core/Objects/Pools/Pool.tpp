@@ -16,19 +16,62 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <stdexcept>
 
 namespace Barrage
 {
   template <typename T>
   ComponentT<T>& Pool::GetComponent(const std::string& componentName)
   {
-    return static_cast<ComponentT<T>&>(*components_.at(componentName));
+    unsigned id = ComponentFactory::GetComponentId(componentName);
+
+    if (id >= components_.size() || !components_[id])
+    {
+      throw std::out_of_range("Pool does not have component \"" + componentName + "\".");
+    }
+    
+    return static_cast<ComponentT<T>&>(*components_[id]);
+  }
+
+  template <typename T>
+  ComponentArrayType<T>& Pool::GetComponentArray(const std::string& componentArrayName)
+  {
+    unsigned id = ComponentFactory::GetComponentArrayId(componentArrayName);
+
+    if (id >= componentArrays_.size() || !componentArrays_[id])
+    {
+      throw std::out_of_range("Pool does not have component array \"" + componentArrayName + "\".");
+    }
+
+    return static_cast<ComponentArrayType<T>&>(*componentArrays_[id]);
+  }
+
+  template <typename T>
+  ComponentT<T>& Pool::GetComponent()
+  {
+    return static_cast<ComponentT<T>&>(*components_[ComponentFactory::GetComponentId<T>()]);
   }
 
   template <typename T>
-  ComponentArrayT<T>& Pool::GetComponentArray(const std::string& componentArrayName)
+  ComponentArrayType<T>& Pool::GetComponentArray()
   {
-    return static_cast<ComponentArrayT<T>&>(*componentArrays_.at(componentArrayName));
+    return static_cast<ComponentArrayType<T>&>(*componentArrays_[ComponentFactory::GetComponentArrayId<T>()]);
+  }
+
+  template <typename T>
+  bool Pool::HasComponent() const
+  {
+    unsigned id = ComponentFactory::GetComponentId<T>();
+
+    return id < components_.size() && components_[id];
+  }
+
+  template <typename T>
+  bool Pool::HasComponentArray() const
+  {
+    unsigned id = ComponentFactory::GetComponentArrayId<T>();
+
+    return id < componentArrays_.size() && componentArrays_[id];
   }
 }
 
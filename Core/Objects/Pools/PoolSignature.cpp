@@ -0,0 +1,63 @@
+/* ======================================================================== */
+/*!
+ * \file            PoolSignature.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A pool signature records which registered components, component arrays,
+   and tags a pool has, one bit per registered ID.
+ */
+ /* ======================================================================== */
+
+#include "stdafx.h"
+#include "PoolSignature.hpp"
+
+namespace Barrage
+{
+  PoolSignature::PoolSignature() :
+    components_(),
+    componentArrays_(),
+    tags_()
+  {
+  }
+
+  void PoolSignature::AddComponent(unsigned id)
+  {
+    components_.set(id);
+  }
+
+  void PoolSignature::AddComponentArray(unsigned id)
+  {
+    componentArrays_.set(id);
+  }
+
+  void PoolSignature::AddTag(unsigned id)
+  {
+    tags_.set(id);
+  }
+
+  bool PoolSignature::Contains(const PoolSignature& mask) const
+  {
+    return 
+      (components_ & mask.components_) == mask.components_ &&
+      (componentArrays_ & mask.componentArrays_) == mask.componentArrays_ &&
+      (tags_ & mask.tags_) == mask.tags_;
+  }
+
+  bool PoolSignature::Intersects(const PoolSignature& other) const
+  {
+    return
+      (components_ & other.components_).any() ||
+      (componentArrays_ & other.componentArrays_).any() ||
+      (tags_ & other.tags_).any();
+  }
+
+  void PoolSignature::Merge(const PoolSignature& other)
+  {
+    components_ |= other.components_;
+    componentArrays_ |= other.componentArrays_;
+    tags_ |= other.tags_;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+/* ======================================================================== */
+/*!
+ * \file            PoolSignature.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A pool signature records which registered components, component arrays,
+   and tags a pool has, one bit per registered ID.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef PoolSignature_BARRAGE_H
+#define PoolSignature_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Components/ComponentFactory.hpp"
+
+#include <bitset>
+
+namespace Barrage
+{
+  using SignatureBits = std::bitset<MAX_REGISTERED_COMPONENTS>;
+
+  //! Bitsets of the components, component arrays, and tags a pool has
+  class PoolSignature
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Default constructor. The signature starts out empty.
+      */
+      /**************************************************************/
+      PoolSignature();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets the bit for a component.
+
+        \param id
+          The ID of the component (from ComponentFactory).
+      */
+      /**************************************************************/
+      void AddComponent(unsigned id);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets the bit for a component array.
+
+        \param id
+          The ID of the component array (from ComponentFactory).
+      */
+      /**************************************************************/
+      void AddComponentArray(unsigned id);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets the bit for a tag.
+
+        \param id
+          The ID of the tag (from ComponentFactory).
+      */
+      /**************************************************************/
+      void AddTag(unsigned id);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Checks if every bit set in another signature is also set in
+          this one.
+
+        \param mask
+          The signature to check against.
+
+        \return
+          Returns true if this signature has every component,
+          component array, and tag in the mask.
+      */
+      /**************************************************************/
+      bool Contains(const PoolSignature& mask) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Checks if this signature shares any set bit with another.
+
+        \param other
+          The signature to check against.
+
+        \return
+          Returns true if both signatures have at least one
+          component, component array, or tag in common.
+      */
+      /**************************************************************/
+      bool Intersects(const PoolSignature& other) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets every bit that's set in another signature.
+
+        \param other
+          The signature to merge into this one.
+      */
+      /**************************************************************/
+      void Merge(const PoolSignature& other);
+
+    private:
+      SignatureBits components_;      //!< One bit per registered component
+      SignatureBits componentArrays_; //!< One bit per registered component array
+      SignatureBits tags_;            //!< One bit per registered tag
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // PoolSignature_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
@@ -17,54 +17,52 @@
 namespace Barrage
 {
   PoolType::PoolType() :
-    tags_(),
-    componentNames_(),
-    componentArrayNames_()
+    mask_(),
+    matchable_(true)
   {
   }
 
   void PoolType::AddTag(const std::string& tag)
   {
-    tags_.push_back(tag);
+    unsigned id = ComponentFactory::GetTagId(tag);
+
+    if (id == INVALID_COMPONENT_ID)
+    {
+      matchable_ = false;
+      return;
+    }
+
+    mask_.AddTag(id);
   }
 
   void PoolType::AddComponent(const std::string& name)
   {
-    componentNames_.push_back(name);
-  }
+    unsigned id = ComponentFactory::GetComponentId(name);
 
-  void PoolType::AddComponentArray(const std::string& name)
-  {
-    componentArrayNames_.push_back(name);
+    if (id == INVALID_COMPONENT_ID)
+    {
+      matchable_ = false;
+      return;
+    }
+
+    mask_.AddComponent(id);
   }
 
-  bool PoolType::MatchesPool(Pool* pool)
+  void PoolType::AddComponentArray(const std::string& name)
   {
-    for (const auto& component : componentNames_)
-    {
-      if (!pool->HasComponent(component))
-      {
-        return false;
-      }
-    }
+    unsigned id = ComponentFactory::GetComponentArrayId(name);
 
-    for (const auto& componentArray : componentArrayNames_)
+    if (id == INVALID_COMPONENT_ID)
     {
-      if (!pool->HasComponentArray(componentArray))
-      {
-        return false;
-      }
+      matchable_ = false;
+      return;
     }
 
-    for (const auto& tag : tags_)
-    {
-      if (!pool->HasTag(tag))
-      {
-        return false;
-      }
-    }
+    mask_.AddComponentArray(id);
+  }
 
-    // if we made it here, the pool matches the pool type
-    return true;
+  bool PoolType::MatchesPool(Pool* pool) const
+  {
+    return matchable_ && pool->signature_.Contains(mask_);
   }
 }
\ No newline at end of file
@@ -17,13 +17,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Pool.hpp"
+#include "PoolSignature.hpp"
 
 #include <string>
-#include <vector>
 
 namespace Barrage
 {
-  //! A combination of names and tags that define a pool type
+  //! A combination of components, component arrays, and tags that define a pool type
   class PoolType
   {
   public:
@@ -74,7 +74,9 @@ namespace Barrage
     /*!
       \brief
         Checks if a pool has at least the tags and components that
-        correspond to the pool type.
+        correspond to the pool type. This is a mask test against the
+        pool's signature. A pool type that names something that was
+        never registered matches no pools.
 
       \param pool
         The pool to examine.
@@ -84,12 +86,11 @@ namespace Barrage
         in the pool type.
     */
     /**************************************************************/
-    bool MatchesPool(Pool* pool);
+    bool MatchesPool(Pool* pool) const;
 
   private:
-    std::vector<std::string> tags_;                //!< The tags of the pool type
-    std::vector<std::string> componentNames_;      //!< The components of the pool type
-    std::vector<std::string> componentArrayNames_; //!< The component arrays of the pool type
+    PoolSignature mask_; //!< The components, component arrays, and tags of the pool type
+    bool matchable_;     //!< False if the pool type requires anything unregistered
   };
 }
 
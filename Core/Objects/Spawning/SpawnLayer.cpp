@@ -26,11 +26,12 @@ namespace Barrage
   {
   }
 
-  void SpawnLayer::SetCapacity(unsigned capacity)
+  void SpawnLayer::SetCapacity(unsigned capacity, unsigned numObjects)
   {
-    groupInfoArray_.SetCapacity(capacity);
+    groupInfoArray_.SetCapacity(capacity, numObjects);
+    groupInfoArray_.Resize(capacity);
 
-    for (unsigned i = 0; i < capacity; ++i)
+    for (unsigned i = numObjects; i < capacity; ++i)
     {
       groupInfoArray_.Data(i) = GroupInfo(baseNumGroups_);
     }
@@ -43,7 +44,7 @@ namespace Barrage
       {
         std::shared_ptr<SpawnRuleWithArray> spawnRulePtr = std::dynamic_pointer_cast<SpawnRuleWithArray>(spawnRule.Get());
 
-        spawnRulePtr->SetCapacity(capacity);
+        spawnRulePtr->SetCapacity(capacity, numObjects);
       }
     }
 
@@ -55,16 +56,16 @@ namespace Barrage
       {
         std::shared_ptr<SpawnRuleWithArray> spawnRulePtr = std::dynamic_pointer_cast<SpawnRuleWithArray>(spawnRule.Get());
 
-        spawnRulePtr->SetCapacity(capacity);
+        spawnRulePtr->SetCapacity(capacity, numObjects);
       }
     }
   }
 
-  void SpawnLayer::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void SpawnLayer::HandleDestructions(const DestructionPlan& plan)
   {
-    unsigned numAliveObjects = groupInfoArray_.HandleDestructions(destructionArray, writeIndex, endIndex);
+    groupInfoArray_.HandleDestructions(plan);
 
-    for (unsigned i = numAliveObjects; i < endIndex; ++i)
+    for (unsigned i = plan.numAliveObjects_; i < plan.endIndex_; ++i)
     {
       groupInfoArray_.Data(i) = GroupInfo(baseNumGroups_);
     }
@@ -77,7 +78,7 @@ namespace Barrage
       {
         std::shared_ptr<SpawnRuleWithArray> spawnRulePtr = std::static_pointer_cast<SpawnRuleWithArray>(spawnRule.Get());
     
-        spawnRulePtr->HandleDestructions(destructionArray, writeIndex, endIndex);
+        spawnRulePtr->HandleDestructions(plan);
       }
     }
     
@@ -89,7 +90,7 @@ namespace Barrage
       {
         std::shared_ptr<SpawnRuleWithArray> spawnRulePtr = std::static_pointer_cast<SpawnRuleWithArray>(spawnRule.Get());
     
-        spawnRulePtr->HandleDestructions(destructionArray, writeIndex, endIndex);
+        spawnRulePtr->HandleDestructions(plan);
       }
     }
   }
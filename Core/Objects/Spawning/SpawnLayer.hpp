@@ -28,9 +28,9 @@ namespace Barrage
     public:
       SpawnLayer();
 
-      void SetCapacity(unsigned capacity);
+      void SetCapacity(unsigned capacity, unsigned numObjects);
 
-      void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex);
+      void HandleDestructions(const DestructionPlan& plan);
 
     public:
       unsigned baseNumGroups_;
@@ -12,41 +12,22 @@
 
 #include "stdafx.h"
 #include "SpawnRule.hpp"
+#include "Spaces/Space.hpp"
 
 namespace Barrage
 {
-  SpawnRule::SpawnRule(const std::string& name) : name_(name)
+  CounterRandom SpawnRuleBatchInfo::GetRandom(unsigned sourceIndex) const
   {
+    return CounterRandom(space_.RNG().GetStartingSeed(), space_.GetTick(), sourceIndex, randomId_);
   }
 
-  const std::string& SpawnRule::GetName() const
+  SpawnRule::SpawnRule(const std::string& name) : name_(name)
   {
-    return name_;
   }
 
-  void SpawnRule::ExecuteFull(
-    Pool& sourcePool,
-    Pool& destinationPool,
-    Space& space,
-    unsigned startIndex,
-    std::vector<unsigned>& sourceIndices,
-    ComponentArrayT<GroupInfo>& groupInfoArray
-  )
+  const std::string& SpawnRule::GetName() const
   {
-    unsigned currentStartIndex = startIndex;
-    
-    for (auto it = sourceIndices.begin(); it != sourceIndices.end(); ++it)
-    {
-      unsigned sourceIndex = *it;
-      GroupInfo& groupInfo = groupInfoArray.Data(sourceIndex);
-      unsigned currentNumObjects = groupInfo.numGroups_ * groupInfo.numObjectsPerGroup_ * groupInfo.numLayerCopies_;
-
-      SpawnRuleInfo info(sourcePool, destinationPool, space, currentStartIndex, sourceIndex, groupInfo);
-
-      Execute(info);
-
-      currentStartIndex += currentNumObjects;
-    }
+    return name_;
   }
 
   rttr::variant SpawnRule::GetRTTRValue()
@@ -74,17 +55,63 @@ namespace Barrage
     UNREFERENCED(info);
   }
 
+  void SpawnRule::ExecuteBatch(SpawnRuleBatchInfo& info)
+  {
+    unsigned currentStartIndex = info.startIndex_;
+
+    for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+    {
+      unsigned sourceIndex = *it;
+      GroupInfo& groupInfo = info.groupInfoArray_.Data(sourceIndex);
+      unsigned currentNumObjects = CalculateDestinationCount(groupInfo);
+
+      SpawnRuleInfo spawnerInfo(info.sourcePool_, info.destinationPool_, info.space_, currentStartIndex, sourceIndex, groupInfo);
+
+      Execute(spawnerInfo);
+
+      currentStartIndex += currentNumObjects;
+    }
+  }
+
   unsigned SpawnRule::CalculateDestinationIndex(
     SpawnRuleInfo& info, 
     unsigned objectNumber, 
     unsigned groupNumber, 
     unsigned layerCopyNumber)
   {
-    unsigned numObjectsPerLayerCopy = info.groupInfo_.numGroups_ * info.groupInfo_.numObjectsPerGroup_;
-    unsigned layerOffset = layerCopyNumber * numObjectsPerLayerCopy;
-    unsigned groupOffset = groupNumber * info.groupInfo_.numObjectsPerGroup_;
+    return CalculateDestinationIndex(info.groupInfo_, info.startIndex_, objectNumber, groupNumber, layerCopyNumber);
+  }
+
+  unsigned SpawnRule::CalculateDestinationCount(SpawnRuleInfo& info)
+  {
+    return CalculateDestinationCount(info.groupInfo_);
+  }
+
+  unsigned SpawnRule::CalculateDestinationIndex(
+    const GroupInfo& groupInfo,
+    unsigned startIndex,
+    unsigned objectNumber,
+    unsigned groupNumber,
+    unsigned layerCopyNumber)
+  {
+    return groupInfo.GetObjectIndex(startIndex, objectNumber, groupNumber, layerCopyNumber);
+  }
+
+  unsigned SpawnRule::CalculateDestinationCount(const GroupInfo& groupInfo)
+  {
+    return groupInfo.GetObjectCount();
+  }
+
+  unsigned SpawnRule::CalculateBatchCount(SpawnRuleBatchInfo& info)
+  {
+    unsigned count = 0;
+
+    for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+    {
+      count += CalculateDestinationCount(info.groupInfoArray_.Data(*it));
+    }
 
-    return info.startIndex_ + layerOffset + groupOffset + objectNumber;
+    return count;
   }
 
   SpawnRuleWithArray::SpawnRuleWithArray(const std::string& name) : SpawnRule(name)
@@ -16,6 +16,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Objects/Components/ComponentArray.hpp"
+#include "Random/CounterRandom.hpp"
 #include <rttr/rttr_enable.h>
 #include <string>
 
@@ -32,6 +33,15 @@ namespace Barrage
 
     inline GroupInfo() : numObjectsPerGroup_(1), numGroups_(0), numLayerCopies_(1) {}
     inline GroupInfo(unsigned numGroups) : numObjectsPerGroup_(1), numGroups_(numGroups), numLayerCopies_(1) {}
+
+    // index of an object from a spawner whose objects start at startIndex (layer copies, then groups, then objects)
+    inline unsigned GetObjectIndex(unsigned startIndex, unsigned object, unsigned group, unsigned layerCopy) const
+    {
+      return startIndex + (layerCopy * numGroups_ + group) * numObjectsPerGroup_ + object;
+    }
+
+    // number of objects the spawner produces
+    inline unsigned GetObjectCount() const { return numLayerCopies_ * numGroups_ * numObjectsPerGroup_; }
   };
 
   struct SpawnRuleInfo
@@ -61,6 +71,41 @@ namespace Barrage
     }
   };
 
+  //! Everything a spawn rule needs to run for every spawner of a spawn type at once
+  struct SpawnRuleBatchInfo
+  {
+    Pool& sourcePool_;
+    Pool& destinationPool_;
+    Space& space_;
+    unsigned startIndex_;                         // index of the first object produced by the first spawner
+    std::vector<unsigned>& sourceIndices_;        // spawners, in the order their objects were produced
+    ComponentArrayT<GroupInfo>& groupInfoArray_;  // group sizes for this layer, indexed by spawner
+    unsigned randomId_;                           // tells this rule's random streams apart from other rules' and from earlier queues on the same tick
+
+    inline SpawnRuleBatchInfo(
+      Pool& sourcePool,
+      Pool& destinationPool,
+      Space& space,
+      unsigned startIndex,
+      std::vector<unsigned>& sourceIndices,
+      ComponentArrayT<GroupInfo>& groupInfoArray,
+      unsigned randomId
+    ) :
+      sourcePool_(sourcePool),
+      destinationPool_(destinationPool),
+      space_(space),
+      startIndex_(startIndex),
+      sourceIndices_(sourceIndices),
+      groupInfoArray_(groupInfoArray),
+      randomId_(randomId)
+    {
+    }
+
+    // random values for one spawner's objects, indexed by group; streams are keyed by the
+    // spawner itself, so the values don't depend on which other spawners fired or in what order
+    CounterRandom GetRandom(unsigned sourceIndex) const;
+  };
+
   enum class SpawnRuleStage
   {
     COUNT_RULE,
@@ -122,14 +167,22 @@ namespace Barrage
       /**************************************************************/
       virtual void Execute(SpawnRuleInfo& info);
 
-      void ExecuteFull(
-        Pool& sourcePool,
-        Pool& destinationPool,
-        Space& space,
-        unsigned startIndex,
-        std::vector<unsigned>& sourceIndices,
-        ComponentArrayT<GroupInfo>& groupInfoArray
-      );
+      /**************************************************************/
+      /*!
+        \brief
+          Executes the spawn rule for all objects from every spawner
+          of a spawn type. The objects of each spawner directly
+          follow the objects of the spawner before it. By default,
+          this calls Execute() once per spawner; rules override it
+          to look up their component arrays once and write whole
+          runs of objects at a time.
+
+        \param info
+          Contains information about the current spawn (source pool,
+          destination pool, spawners, group sizes, etc).
+      */
+      /**************************************************************/
+      virtual void ExecuteBatch(SpawnRuleBatchInfo& info);
 
       /**************************************************************/
       /*!
@@ -213,6 +266,90 @@ namespace Barrage
         unsigned groupNumber,
         unsigned layerCopyNumber
       );
+
+      /**************************************************************/
+      /*!
+        \brief
+          Helper function for calculating how many objects the
+          spawner produced. They're contiguous, starting at
+          CalculateDestinationIndex(info, 0, 0, 0), so rules that
+          treat every object the same can update them as one run.
+
+        \param info
+          Information about the current spawn.
+
+        \return
+          Returns the number of objects produced by the spawner.
+      */
+      /**************************************************************/
+      static unsigned CalculateDestinationCount(SpawnRuleInfo& info);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Same as CalculateDestinationIndex() above, for batched
+          rules that walk the spawners themselves.
+
+        \param groupInfo
+          The spawner's group sizes.
+
+        \param startIndex
+          The index of the first object produced by the spawner.
+
+        \param objectNumber
+          In a group, the number of the current object (starting at
+          zero).
+
+        \param groupNumber
+          In a layer copy, the number of the current group (starting
+          at zero).
+
+        \param layerCopyNumber
+          The number of the current layer copy.
+
+        \return
+          Returns the index of the object to modify.
+      */
+      /**************************************************************/
+      static unsigned CalculateDestinationIndex(
+        const GroupInfo& groupInfo,
+        unsigned startIndex,
+        unsigned objectNumber,
+        unsigned groupNumber,
+        unsigned layerCopyNumber
+      );
+
+      /**************************************************************/
+      /*!
+        \brief
+          Same as CalculateDestinationCount() above, for batched
+          rules that walk the spawners themselves.
+
+        \param groupInfo
+          The spawner's group sizes.
+
+        \return
+          Returns the number of objects produced by the spawner.
+      */
+      /**************************************************************/
+      static unsigned CalculateDestinationCount(const GroupInfo& groupInfo);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Helper function for calculating how many objects all
+          spawners in a batch produced. They're contiguous, starting
+          at info.startIndex_, so rules that treat every object the
+          same can update the whole batch as one run.
+
+        \param info
+          Information about the current spawn.
+
+        \return
+          Returns the number of objects produced by the batch.
+      */
+      /**************************************************************/
+      static unsigned CalculateBatchCount(SpawnRuleBatchInfo& info);
     
     private:
       std::string name_;
@@ -285,9 +422,13 @@ namespace Barrage
 
         \param capacity
           The number of elements in this spawn rule's data array.
+
+        \param numObjects
+          The number of objects whose data should be kept (objects
+          past this point are reset to default values).
       */
       /**************************************************************/
-      virtual void SetCapacity(unsigned capacity) = 0;
+      virtual void SetCapacity(unsigned capacity, unsigned numObjects) = 0;
 
       /**************************************************************/
       /*!
@@ -296,18 +437,11 @@ namespace Barrage
           the positions of still-alive spawners when some spawners
           have been destroyed.
 
-        \param destructionArray
-          Array of bools that tell whether each spawner is destroyed
-          or not.
-
-        \param writeIndex
-          The index of the first dead object.
-
-        \param endIndex
-          One past the index of the last object that could be alive.
+        \param plan
+          The moves that pack the spawners' pool after destructions.
       */
       /**************************************************************/
-      virtual void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) = 0;
+      virtual void HandleDestructions(const DestructionPlan& plan) = 0;
 
       /**************************************************************/
       /*!
@@ -375,9 +509,13 @@ namespace Barrage
 
         \param capacity
           The number of elements in this spawn rule's data array.
+
+        \param numObjects
+          The number of objects whose data should be kept (objects
+          past this point are reset to default values).
       */
       /**************************************************************/
-      void SetCapacity(unsigned capacity) override;
+      void SetCapacity(unsigned capacity, unsigned numObjects) override;
 
       /**************************************************************/
       /*!
@@ -386,12 +524,11 @@ namespace Barrage
           of still-alive spawners when some spawners have been
           destroyed.
 
-        \param destructionArray
-          Array of bools that tell whether each spawner is destroyed
-          or not.
+        \param plan
+          The moves that pack the spawners' pool after destructions.
       */
       /**************************************************************/
-      void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex) override;
+      void HandleDestructions(const DestructionPlan& plan) override;
 
     protected:
       T data_;
@@ -19,15 +19,78 @@ namespace Barrage
     sourceIndices_(),
     spawnLayers_(),
     destinationPool_(),
-    spawnArchetype_()
+    spawnArchetype_(),
+    valueOps_(),
+    tileSourceIndices_(),
+    randomId_(0),
+    queueTick_(0),
+    numQueues_(0)
   {
   }
 
+  void SpawnType::Compile()
+  {
+    valueOps_.clear();
+
+    for (unsigned layer = 0; layer < spawnLayers_.size(); ++layer)
+    {
+      for (unsigned rule = 0; rule < spawnLayers_[layer].valueRules_.size(); ++rule)
+      {
+        valueOps_.emplace_back(layer, rule);
+      }
+    }
+  }
+
+  bool SpawnType::IsCompiled() const
+  {
+    size_t numValueRules = 0;
+
+    for (auto it = spawnLayers_.begin(); it != spawnLayers_.end(); ++it)
+    {
+      numValueRules += it->valueRules_.size();
+    }
+
+    if (numValueRules != valueOps_.size())
+    {
+      return false;
+    }
+
+    // with the same total, every op in range means no layer lost or gained a rule
+    for (auto it = valueOps_.begin(); it != valueOps_.end(); ++it)
+    {
+      if (it->layer_ >= spawnLayers_.size() || it->rule_ >= spawnLayers_[it->layer_].valueRules_.size())
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   void SpawnType::CreateSpawn(unsigned sourceIndex)
   {
     sourceIndices_.push_back(sourceIndex);
   }
 
+  unsigned SpawnType::NextRandomId(unsigned tick)
+  {
+    if (tick != queueTick_)
+    {
+      queueTick_ = tick;
+      numQueues_ = 0;
+    }
+
+    unsigned numRules = static_cast<unsigned>(valueOps_.size());
+
+    for (auto it = spawnLayers_.begin(); it != spawnLayers_.end(); ++it)
+    {
+      numRules += static_cast<unsigned>(it->countRules_.size());
+    }
+
+    // a spawner only shows up once per queue, so its streams stay apart if it's queued again on the same tick
+    return randomId_ + numRules * numQueues_++;
+  }
+
   void SpawnType::ClearSpawns()
   {
     sourceIndices_.clear();
@@ -81,6 +144,37 @@ namespace Barrage
     }
   }
 
+  unsigned SpawnType::GetSpawnSize() const
+  {
+    unsigned totalSpawns = 0;
+
+    if (!spawnLayers_.empty())
+    {
+      const SpawnLayer& lastLayer = spawnLayers_.back();
+
+      for (auto it = sourceIndices_.begin(); it != sourceIndices_.end(); ++it)
+      {
+        const GroupInfo& groupInfo = lastLayer.groupInfoArray_.Data(*it);
+
+        totalSpawns += groupInfo.numGroups_ * groupInfo.numObjectsPerGroup_;
+      }
+    }
+
+    return totalSpawns;
+  }
+
+  unsigned SpawnType::GetSpawnSize(unsigned sourceIndex) const
+  {
+    if (spawnLayers_.empty())
+    {
+      return 0;
+    }
+
+    const GroupInfo& groupInfo = spawnLayers_.back().groupInfoArray_.Data(sourceIndex);
+
+    return groupInfo.numGroups_ * groupInfo.numObjectsPerGroup_;
+  }
+
   unsigned SpawnType::FinalizeSpawnSize(unsigned maxSpawns)
   {
     unsigned totalSpawns = 0;
@@ -110,25 +204,26 @@ namespace Barrage
     return totalSpawns;
   }
 
-  void SpawnType::SetCapacity(unsigned capacity)
+  void SpawnType::SetCapacity(unsigned capacity, unsigned numObjects)
   {
     sourceIndices_.reserve(capacity);
+    tileSourceIndices_.reserve(capacity);
     
     for (auto it = spawnLayers_.begin(); it != spawnLayers_.end(); ++it)
     {
       SpawnLayer& spawnLayer = *it;
 
-      spawnLayer.SetCapacity(capacity);
+      spawnLayer.SetCapacity(capacity, numObjects);
     }
   }
 
-  void SpawnType::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void SpawnType::HandleDestructions(const DestructionPlan& plan)
   {
     for (auto it = spawnLayers_.begin(); it != spawnLayers_.end(); ++it)
     {
       SpawnLayer& spawnLayer = *it;
 
-      spawnLayer.HandleDestructions(destructionArray, writeIndex, endIndex);
+      spawnLayer.HandleDestructions(plan);
     }
   }
 }
\ No newline at end of file
@@ -19,28 +19,57 @@
 
 namespace Barrage
 {
+  //! A value rule in a compiled spawn type, found by its layer and its place in that layer
+  struct SpawnOp
+  {
+    unsigned layer_;
+    unsigned rule_;
+
+    inline SpawnOp(unsigned layer, unsigned rule) : layer_(layer), rule_(rule) {}
+  };
+
   class SpawnType
   {
     public:
+      static constexpr unsigned TILE_SIZE = 512; // most objects the value rules run on at a time (a single spawner may go over)
+
       SpawnType();
 
+      // flattens every layer's value rules into valueOps_, in the order they run
+      void Compile();
+
+      // false if rules were added or removed since the last Compile()
+      bool IsCompiled() const;
+
       void CreateSpawn(unsigned sourceIndex);
 
+      // random id of the first rule for the spawns being queued; each queue on the same tick gets its own range of ids
+      unsigned NextRandomId(unsigned tick);
+
       void ClearSpawns();
 
       void FinalizeGroupInfo();
 
+      unsigned GetSpawnSize() const;
+
+      unsigned GetSpawnSize(unsigned sourceIndex) const;
+
       unsigned FinalizeSpawnSize(unsigned maxSpawns);
 
-      void SetCapacity(unsigned capacity);
+      void SetCapacity(unsigned capacity, unsigned numObjects);
 
-      void HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex);
+      void HandleDestructions(const DestructionPlan& plan);
 
     public:
       std::vector<unsigned> sourceIndices_;
       std::vector<SpawnLayer> spawnLayers_;
       std::string destinationPool_;
       std::string spawnArchetype_;
+      std::vector<SpawnOp> valueOps_;
+      std::vector<unsigned> tileSourceIndices_;
+      unsigned randomId_; // random id of the first value rule; each later rule adds one
+      unsigned queueTick_; // the tick spawns were last queued on
+      unsigned numQueues_; // times spawns were queued on queueTick_
 
       friend class Pool;
   };
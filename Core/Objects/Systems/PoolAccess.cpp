@@ -0,0 +1,104 @@
+/* ======================================================================== */
+/*!
+ * \file            PoolAccess.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A pool access lists the components and component arrays a system reads
+   and writes in the pools of one of its pool groups. The system manager
+   uses these to decide which systems can safely update at the same time.
+*/
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "PoolAccess.hpp"
+
+namespace Barrage
+{
+  PoolAccess::PoolAccess() :
+    reads_(),
+    writes_(),
+    writesAll_(false)
+  {
+  }
+
+  void PoolAccess::ReadComponent(const std::string& name)
+  {
+    unsigned id = ComponentFactory::GetComponentId(name);
+
+    if (id == INVALID_COMPONENT_ID)
+    {
+      // can't track an unregistered name, so assume the worst
+      writesAll_ = true;
+      return;
+    }
+
+    reads_.AddComponent(id);
+  }
+
+  void PoolAccess::WriteComponent(const std::string& name)
+  {
+    unsigned id = ComponentFactory::GetComponentId(name);
+
+    if (id == INVALID_COMPONENT_ID)
+    {
+      writesAll_ = true;
+      return;
+    }
+
+    writes_.AddComponent(id);
+  }
+
+  void PoolAccess::ReadComponentArray(const std::string& name)
+  {
+    unsigned id = ComponentFactory::GetComponentArrayId(name);
+
+    if (id == INVALID_COMPONENT_ID)
+    {
+      writesAll_ = true;
+      return;
+    }
+
+    reads_.AddComponentArray(id);
+  }
+
+  void PoolAccess::WriteComponentArray(const std::string& name)
+  {
+    unsigned id = ComponentFactory::GetComponentArrayId(name);
+
+    if (id == INVALID_COMPONENT_ID)
+    {
+      writesAll_ = true;
+      return;
+    }
+
+    writes_.AddComponentArray(id);
+  }
+
+  void PoolAccess::WriteAll()
+  {
+    writesAll_ = true;
+  }
+
+  void PoolAccess::Merge(const PoolAccess& other)
+  {
+    reads_.Merge(other.reads_);
+    writes_.Merge(other.writes_);
+    writesAll_ = writesAll_ || other.writesAll_;
+  }
+
+  bool PoolAccess::ConflictsWith(const PoolAccess& other) const
+  {
+    if (writesAll_ || other.writesAll_)
+    {
+      return true;
+    }
+
+    return
+      writes_.Intersects(other.writes_) ||
+      writes_.Intersects(other.reads_) ||
+      reads_.Intersects(other.writes_);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+/* ======================================================================== */
+/*!
+ * \file            PoolAccess.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A pool access lists the components and component arrays a system reads
+   and writes in the pools of one of its pool groups. The system manager
+   uses these to decide which systems can safely update at the same time.
+*/
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef PoolAccess_BARRAGE_H
+#define PoolAccess_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Pools/PoolSignature.hpp"
+
+#include <map>
+#include <string>
+
+namespace Barrage
+{
+  //! The components and component arrays a system reads and writes in a pool
+  class PoolAccess
+  {
+  public:
+    /**************************************************************/
+    /*!
+      \brief
+        Default constructor. The access starts out empty (touches
+        nothing). Naming a component or component array that isn't
+        registered makes the access write everything, since it
+        can't be tracked.
+    */
+    /**************************************************************/
+    PoolAccess();
+
+    /**************************************************************/
+    /*!
+      \brief
+        Records that a component is read.
+
+      \param name
+        The name of the component.
+    */
+    /**************************************************************/
+    void ReadComponent(const std::string& name);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Records that a component is written (and possibly read).
+
+      \param name
+        The name of the component.
+    */
+    /**************************************************************/
+    void WriteComponent(const std::string& name);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Records that a component array is read.
+
+      \param name
+        The name of the component array.
+    */
+    /**************************************************************/
+    void ReadComponentArray(const std::string& name);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Records that a component array is written (and possibly
+        read).
+
+      \param name
+        The name of the component array.
+    */
+    /**************************************************************/
+    void WriteComponentArray(const std::string& name);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Records that anything in the pool may be written, including
+        its object count (e.g. spawning or destroying objects, or
+        running user-defined code like behavior trees).
+    */
+    /**************************************************************/
+    void WriteAll();
+
+    /**************************************************************/
+    /*!
+      \brief
+        Adds everything another access touches to this one.
+
+      \param other
+        The access to merge into this one.
+    */
+    /**************************************************************/
+    void Merge(const PoolAccess& other);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Checks if two accesses to the same pool can't safely happen
+        at the same time (one writes something the other reads or
+        writes).
+
+      \param other
+        The access to check against.
+
+      \return
+        Returns true if the accesses conflict.
+    */
+    /**************************************************************/
+    bool ConflictsWith(const PoolAccess& other) const;
+
+  private:
+    PoolSignature reads_;  //!< Components and component arrays that are read
+    PoolSignature writes_; //!< Components and component arrays that are written
+    bool writesAll_;       //!< True if anything in the pool may be written
+  };
+
+  typedef std::map<std::string, PoolAccess, std::less<>> PoolAccessMap;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // PoolAccess_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -16,13 +16,17 @@
 
 #include "stdafx.h"
 #include "System.hpp"
+#include "Engine.hpp"
+
+#include <algorithm>
 
 namespace Barrage
 {
   System::System() :
     space_(nullptr),
     poolTypes_(),
-    poolGroups_()
+    poolGroups_(),
+    poolAccess_()
   {
   }
 
@@ -73,6 +77,54 @@ namespace Barrage
     // intentionally empty - specialized in subclasses
   }
 
+  PoolAccess System::GetPoolAccess(Pool* pool) const
+  {
+    PoolAccess access;
+
+    for (auto it = poolGroups_.begin(); it != poolGroups_.end(); ++it)
+    {
+      const std::vector<Pool*>& pool_group = it->second;
+
+      if (std::find(pool_group.begin(), pool_group.end(), pool) == pool_group.end())
+      {
+        continue;
+      }
+
+      auto jt = poolAccess_.find(it->first);
+
+      if (jt != poolAccess_.end())
+      {
+        access.Merge(jt->second);
+      }
+      else
+      {
+        access.WriteAll();
+      }
+    }
+
+    return access;
+  }
+
+  std::vector<Pool*> System::GetSubscribedPools() const
+  {
+    std::vector<Pool*> pools;
+
+    for (auto it = poolGroups_.begin(); it != poolGroups_.end(); ++it)
+    {
+      const std::vector<Pool*>& pool_group = it->second;
+
+      for (auto jt = pool_group.begin(); jt != pool_group.end(); ++jt)
+      {
+        if (std::find(pools.begin(), pools.end(), *jt) == pools.end())
+        {
+          pools.push_back(*jt);
+        }
+      }
+    }
+
+    return pools;
+  }
+
   void System::UpdatePoolGroup(const std::string& group, PoolUpdateFunction function)
   {
     if (poolGroups_.find(group) != poolGroups_.end())
@@ -96,6 +148,44 @@ namespace Barrage
     }
   }
 
+  void System::UpdatePoolGroupParallel(const std::string& group, PoolRangeUpdateFunction function)
+  {
+    auto it = poolGroups_.find(group);
+
+    if (it == poolGroups_.end())
+    {
+      return;
+    }
+
+    std::vector<Pool*>& pool_group = it->second;
+    JobSystem& jobs = Engine::Get().Jobs();
+    JobCounter counter(0);
+    Space* space = space_;
+
+    for (auto jt = pool_group.begin(); jt != pool_group.end(); ++jt)
+    {
+      Pool* pool = *jt;
+      unsigned num_objects = pool->ActiveObjectCount();
+
+      if (jobs.GetWorkerCount() == 0)
+      {
+        function(*space, *pool, 0, num_objects);
+        continue;
+      }
+
+      // a non-empty pool is at least one job, so small pools still update alongside each other; an empty pool gets none
+      for (unsigned begin = 0; begin < num_objects; begin += PARALLEL_RANGE_SIZE)
+      {
+        unsigned end = std::min(begin + PARALLEL_RANGE_SIZE, num_objects);
+
+        counter.fetch_add(1);
+        jobs.Submit([function, space, pool, begin, end]() { function(*space, *pool, begin, end); }, &counter);
+      }
+    }
+
+    jobs.WaitFor(counter);
+  }
+
   void System::UpdateInteraction(const std::string& group1, const std::string& group2, InteractionFunction function)
   {
     std::vector<Pool*>& pool_group_1 = poolGroups_[group1];
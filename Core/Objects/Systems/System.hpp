@@ -21,15 +21,22 @@
 
 #include "../Pools/Pool.hpp"
 #include "../Pools/PoolType.hpp"
+#include "PoolAccess.hpp"
 
 namespace Barrage
 {
   class System;
 
+  constexpr unsigned PARALLEL_RANGE_SIZE = 4096; //!< Most objects a single job handles in a data-parallel pool update
+
+  // packed per-object bitsets (like Destructible) are written a 64-bit word at a time, so ranges must not share words
+  static_assert(PARALLEL_RANGE_SIZE % 64 == 0, "PARALLEL_RANGE_SIZE must be a multiple of 64");
+
   typedef std::map<std::string, PoolType, std::less<>> PoolTypeMap;
   typedef std::map<std::string, std::vector<Pool*>, std::less<>> PoolGroupMap;
 
   using PoolUpdateFunction = void (*)(Space&, Pool&);
+  using PoolRangeUpdateFunction = void (*)(Space&, Pool&, unsigned, unsigned);
   using InteractionFunction = void (*)(Space&, Pool&, Pool&);
   using PoolUpdateMemberFunction = void (System::*)(Space&, Pool&);
   using InteractionMemberFunction = void (System::*)(Space&, Pool&, Pool&);
@@ -100,10 +107,42 @@ namespace Barrage
           to the system. The default version simply loops through
           every object pool and calls UpdatePool on it, but the user
           may specify their own Update function.
+
+          Systems that don't conflict may update at the same time, so
+          Update should only touch pools in the system's pool groups,
+          as declared in poolAccess_.
       */
       /**************************************************************/
       virtual void Update();
 
+      /**************************************************************/
+      /*!
+        \brief
+          Gets everything the system may read or write in a pool
+          during Update(), merged across every pool group the pool
+          belongs to. Pool groups without a declared access are
+          assumed to write everything.
+
+        \param pool
+          The pool to get the access for.
+
+        \return
+          Returns the system's access to the pool.
+      */
+      /**************************************************************/
+      PoolAccess GetPoolAccess(Pool* pool) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets every pool subscribed to the system (each listed once).
+
+        \return
+          Returns the list of subscribed pools.
+      */
+      /**************************************************************/
+      std::vector<Pool*> GetSubscribedPools() const;
+
     protected:
       /**************************************************************/
       /*!
@@ -134,6 +173,30 @@ namespace Barrage
       /**************************************************************/
       void UpdatePoolGroup(const std::string& group, PoolUpdateMemberFunction function);
 
+      /**************************************************************/
+      /*!
+        \brief
+          Applies a data-parallel function to all pools in the given
+          group. Each pool's active objects are split into ranges of
+          at most PARALLEL_RANGE_SIZE objects, and the ranges of all
+          pools are spread across the engine's job system. Returns
+          once every range has been updated.
+
+          The function may only touch the objects in its range (plus
+          anything it reads but nothing writes), so the results are
+          the same no matter how the ranges are split or scheduled.
+
+        \param group
+          The key of the pool group.
+
+        \param function
+          The function to apply to each range of objects. It is
+          given the space, the pool, and the range [begin, end) of
+          object indices to update.
+      */
+      /**************************************************************/
+      void UpdatePoolGroupParallel(const std::string& group, PoolRangeUpdateFunction function);
+
       /**************************************************************/
       /*!
         \brief
@@ -172,8 +235,9 @@ namespace Barrage
 
     protected:
       Space* space_;
-      PoolTypeMap poolTypes_;   //!< Holds all pool types the system cares about
-      PoolGroupMap poolGroups_; //!< Holds all subscribed pools in a specific order
+      PoolTypeMap poolTypes_;    //!< Holds all pool types the system cares about
+      PoolGroupMap poolGroups_;  //!< Holds all subscribed pools in a specific order
+      PoolAccessMap poolAccess_; //!< What the system reads and writes in each pool group
   };
 }
 
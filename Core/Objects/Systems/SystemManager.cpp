@@ -13,13 +13,18 @@
 #include "stdafx.h"
 #include "SystemManager.hpp"
 #include "Registration/Registrar.hpp"
+#include "Engine.hpp"
+
+#include <algorithm>
 
 namespace Barrage
 {
   SystemManager::SystemManager(Space& space) :
     space_(space),
     systems_(),
-    updateOrderList_(Registrar::GetSystemUpdateOrder())
+    updateOrderList_(Registrar::GetSystemUpdateOrder()),
+    schedule_(),
+    scheduleDirty_(true)
   {
     const StringSet& systemNames = SystemFactory::GetSystemNames();
 
@@ -39,6 +44,8 @@ namespace Barrage
 
         system->Subscribe(space_, pool);
       }
+
+      scheduleDirty_ = true;
     }
   }
 
@@ -50,17 +57,47 @@ namespace Barrage
 
       system->Unsubscribe(space_, pool);
     }
+
+    scheduleDirty_ = true;
   }
 
   void SystemManager::Update()
   {
-    for (auto it = updateOrderList_.begin(); it != updateOrderList_.end(); ++it)
+    if (scheduleDirty_)
+    {
+      BuildSchedule();
+    }
+
+    unsigned num_systems = static_cast<unsigned>(schedule_.size());
+    JobSystem& jobs = Engine::Get().Jobs();
+
+    if (jobs.GetWorkerCount() == 0)
+    {
+      for (auto it = schedule_.begin(); it != schedule_.end(); ++it)
+      {
+        it->system_->Update();
+      }
+
+      return;
+    }
+
+    std::vector<JobCounter> remaining(num_systems);
+    JobCounter counter(num_systems);
+
+    for (unsigned i = 0; i < num_systems; ++i)
     {
-      if (systems_.find(*it) != systems_.end())
+      remaining[i].store(schedule_[i].numDependencies_);
+    }
+
+    for (unsigned i = 0; i < num_systems; ++i)
+    {
+      if (schedule_[i].numDependencies_ == 0)
       {
-        systems_.at(*it)->Update();
+        jobs.Submit([this, i, &jobs, &remaining, &counter]() { RunScheduledSystem(i, jobs, remaining, counter); }, &counter);
       }
     }
+
+    jobs.WaitFor(counter);
   }
 
   std::shared_ptr<System> SystemManager::GetSystem(const std::string& name)
@@ -79,5 +116,90 @@ namespace Barrage
   void SystemManager::SetUpdateOrder(const std::vector<std::string>& updateOrderList)
   {
     updateOrderList_ = updateOrderList;
+    scheduleDirty_ = true;
+  }
+
+  void SystemManager::BuildSchedule()
+  {
+    std::vector<std::vector<Pool*>> subscribed_pools;
+
+    schedule_.clear();
+
+    for (auto it = updateOrderList_.begin(); it != updateOrderList_.end(); ++it)
+    {
+      auto jt = systems_.find(*it);
+
+      if (jt != systems_.end())
+      {
+        schedule_.push_back(ScheduledSystem{ jt->second.get(), std::vector<unsigned>(), 0 });
+        subscribed_pools.push_back(jt->second->GetSubscribedPools());
+      }
+    }
+
+    unsigned num_systems = static_cast<unsigned>(schedule_.size());
+
+    for (unsigned j = 0; j < num_systems; ++j)
+    {
+      System* later_system = schedule_[j].system_;
+
+      for (unsigned i = 0; i < j; ++i)
+      {
+        System* earlier_system = schedule_[i].system_;
+
+        // a system listed twice in the update order can't overlap with itself
+        bool conflicts = earlier_system == later_system;
+
+        for (auto it = subscribed_pools[i].begin(); it != subscribed_pools[i].end() && !conflicts; ++it)
+        {
+          Pool* pool = *it;
+
+          if (std::find(subscribed_pools[j].begin(), subscribed_pools[j].end(), pool) != subscribed_pools[j].end())
+          {
+            conflicts = earlier_system->GetPoolAccess(pool).ConflictsWith(later_system->GetPoolAccess(pool));
+          }
+        }
+
+        if (conflicts)
+        {
+          schedule_[i].dependents_.push_back(j);
+          ++schedule_[j].numDependencies_;
+        }
+      }
+    }
+
+    scheduleDirty_ = false;
+  }
+
+  void SystemManager::RunScheduledSystem(unsigned index, JobSystem& jobs, std::vector<JobCounter>& remaining, JobCounter& counter)
+  {
+    ScheduledSystem& scheduled_system = schedule_[index];
+
+    std::exception_ptr error;
+
+    // dependents are still queued if the system throws, or the counter would never reach zero
+    try
+    {
+      scheduled_system.system_->Update();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    for (auto it = scheduled_system.dependents_.begin(); it != scheduled_system.dependents_.end(); ++it)
+    {
+      unsigned dependent = *it;
+
+      // the last system a dependent waits on is the one that queues it
+      if (remaining[dependent].fetch_sub(1) == 1)
+      {
+        jobs.Submit([this, dependent, &jobs, &remaining, &counter]() { RunScheduledSystem(dependent, jobs, remaining, counter); }, &counter);
+      }
+    }
+
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
   }
 }
\ No newline at end of file
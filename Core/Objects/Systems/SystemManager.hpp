@@ -16,6 +16,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "System.hpp"
+#include "Jobs/JobSystem.hpp"
 
 namespace Barrage
 {
@@ -64,6 +65,11 @@ namespace Barrage
         \brief
           Updates each system, carrying out system functions on all
           object pools subscribed to the systems.
+
+          Systems run in update order wherever they touch a shared
+          pool in a conflicting way (see System::GetPoolAccess()).
+          Systems that don't conflict may update at the same time on
+          the engine's job system.
       */
       /**************************************************************/
       void Update();
@@ -106,10 +112,52 @@ namespace Barrage
       /**************************************************************/
       void SetUpdateOrder(const std::vector<std::string>& updateOrderList);
 
+    private:
+      //! A system in the update schedule and the systems that must wait on it
+      struct ScheduledSystem
+      {
+        System* system_;                   //!< The system to update
+        std::vector<unsigned> dependents_; //!< Indices of later systems that conflict with this one
+        unsigned numDependencies_;         //!< Number of earlier systems this one waits on
+      };
+
+      /**************************************************************/
+      /*!
+        \brief
+          Rebuilds the update schedule. Each system waits only on the
+          earlier systems (in update order) that touch a shared pool
+          in a conflicting way.
+      */
+      /**************************************************************/
+      void BuildSchedule();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Updates a scheduled system, then queues each dependent that
+          has no more systems to wait on.
+
+        \param index
+          The index of the system in the schedule.
+
+        \param jobs
+          The job system to queue dependents on.
+
+        \param remaining
+          The number of systems each scheduled system still waits on.
+
+        \param counter
+          Counts systems that haven't finished updating.
+      */
+      /**************************************************************/
+      void RunScheduledSystem(unsigned index, JobSystem& jobs, std::vector<JobCounter>& remaining, JobCounter& counter);
+
     private:
       Space& space_;                             //!< The space the system manager lives in
       SystemMap systems_;                        //!< The collection of registered systems
       std::vector<std::string> updateOrderList_; //!< The order the systems will update in
+      std::vector<ScheduledSystem> schedule_;    //!< Registered systems in update order, with dependencies
+      bool scheduleDirty_;                       //!< True if the schedule must be rebuilt before updating
   };
 }
 
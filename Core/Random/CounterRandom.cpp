@@ -0,0 +1,222 @@
+/* ======================================================================== */
+/*!
+ * \file            CounterRandom.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Counter-based random number generator based on Philox4x32-10. Each value
+   is worked out from a key and the value's index alone, with no state
+   carried from one value to the next. Values can be made in any order and
+   on any thread and still come out the same, which is what spawning needs
+   to run in parallel and replay the same way every time.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "CounterRandom.hpp"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BARRAGE_X64
+#include <emmintrin.h>
+#endif
+
+namespace Barrage
+{
+  static_assert(sizeof(unsigned) == 4, "CounterRandom needs a 32-bit unsigned");
+
+  namespace
+  {
+    // multipliers and key steps from Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"
+    constexpr unsigned PHILOX_M0 = 0xD2511F53;
+    constexpr unsigned PHILOX_M1 = 0xCD9E8D57;
+    constexpr unsigned PHILOX_W0 = 0x9E3779B9;
+    constexpr unsigned PHILOX_W1 = 0xBB67AE85;
+
+    // the top 24 bits of a value, scaled into [0, 1), are exact in a float
+    constexpr float FLOAT_SCALE = 1.0f / 16777216.0f;
+  }
+
+  CounterRandom::CounterRandom(unsigned long long seed, unsigned tick, unsigned stream, unsigned rule) :
+    key_{ static_cast<unsigned>(seed), static_cast<unsigned>(seed >> 32) },
+    counter_{ tick, stream, rule }
+  {
+  }
+
+  unsigned CounterRandom::Value(unsigned index) const
+  {
+    unsigned block[VALUES_PER_BLOCK];
+
+    GenerateBlock(index / VALUES_PER_BLOCK, block);
+
+    return block[index % VALUES_PER_BLOCK];
+  }
+
+  float CounterRandom::Float(unsigned index) const
+  {
+    return static_cast<float>(Value(index) >> 8) * FLOAT_SCALE;
+  }
+
+  float CounterRandom::RangeFloat(unsigned index, float min, float max) const
+  {
+    return min + Float(index) * (max - min);
+  }
+
+  void CounterRandom::FillFloats(float* values, unsigned firstIndex, unsigned count, float min, float max) const
+  {
+    FillFloatsSSE2(values, firstIndex, count, min, max);
+  }
+
+  void CounterRandom::FillFloatsScalar(float* values, unsigned firstIndex, unsigned count, float min, float max) const
+  {
+    float range = max - min;
+    unsigned i = 0;
+
+    // each block is generated once, however many of its values are wanted
+    while (i < count)
+    {
+      unsigned index = firstIndex + i;
+      unsigned block[VALUES_PER_BLOCK];
+
+      GenerateBlock(index / VALUES_PER_BLOCK, block);
+
+      for (unsigned word = index % VALUES_PER_BLOCK; word < VALUES_PER_BLOCK && i < count; ++word)
+      {
+        values[i] = min + static_cast<float>(block[word] >> 8) * FLOAT_SCALE * range;
+        ++i;
+      }
+    }
+  }
+
+  unsigned CounterRandom::Hash(const std::string& name)
+  {
+    unsigned hash = 2166136261u;
+
+    for (auto it = name.begin(); it != name.end(); ++it)
+    {
+      hash ^= static_cast<unsigned char>(*it);
+      hash *= 16777619u;
+    }
+
+    return hash;
+  }
+
+  void CounterRandom::GenerateBlock(unsigned block, unsigned result[VALUES_PER_BLOCK]) const
+  {
+    unsigned x0 = block;
+    unsigned x1 = counter_[0];
+    unsigned x2 = counter_[1];
+    unsigned x3 = counter_[2];
+    unsigned k0 = key_[0];
+    unsigned k1 = key_[1];
+
+    for (unsigned round = 0; round < ROUNDS; ++round)
+    {
+      unsigned long long product0 = static_cast<unsigned long long>(PHILOX_M0) * x0;
+      unsigned long long product1 = static_cast<unsigned long long>(PHILOX_M1) * x2;
+
+      x0 = static_cast<unsigned>(product1 >> 32) ^ x1 ^ k0;
+      x1 = static_cast<unsigned>(product1);
+      x2 = static_cast<unsigned>(product0 >> 32) ^ x3 ^ k1;
+      x3 = static_cast<unsigned>(product0);
+
+      k0 += PHILOX_W0;
+      k1 += PHILOX_W1;
+    }
+
+    result[0] = x0;
+    result[1] = x1;
+    result[2] = x2;
+    result[3] = x3;
+  }
+
+#ifdef BARRAGE_X64
+  namespace
+  {
+    // 32 x 32 -> 64 bit products of all four lanes, split into high and low halves
+    void MultiplyHiLo(__m128i a, __m128i multiplier, __m128i& high, __m128i& low)
+    {
+      __m128i even = _mm_shuffle_epi32(_mm_mul_epu32(a, multiplier), _MM_SHUFFLE(3, 1, 2, 0));
+      __m128i odd = _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(a, 32), multiplier), _MM_SHUFFLE(3, 1, 2, 0));
+
+      low = _mm_unpacklo_epi32(even, odd);
+      high = _mm_unpackhi_epi32(even, odd);
+    }
+
+    __m128 ToRange(__m128i value, __m128 min, __m128 range)
+    {
+      __m128 unit = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(value, 8)), _mm_set1_ps(FLOAT_SCALE));
+
+      return _mm_add_ps(min, _mm_mul_ps(unit, range));
+    }
+  }
+
+  void CounterRandom::FillFloatsSSE2(float* values, unsigned firstIndex, unsigned count, float min, float max) const
+  {
+    // line up on a block boundary so each lane holds one whole block
+    unsigned i = (VALUES_PER_BLOCK - firstIndex % VALUES_PER_BLOCK) % VALUES_PER_BLOCK;
+
+    if (i >= count)
+    {
+      FillFloatsScalar(values, firstIndex, count, min, max);
+      return;
+    }
+
+    FillFloatsScalar(values, firstIndex, i, min, max);
+
+    const __m128i m0 = _mm_set1_epi32(static_cast<int>(PHILOX_M0));
+    const __m128i m1 = _mm_set1_epi32(static_cast<int>(PHILOX_M1));
+    const __m128 minimum = _mm_set1_ps(min);
+    const __m128 range = _mm_set1_ps(max - min);
+
+    for (; i + 4 * VALUES_PER_BLOCK <= count; i += 4 * VALUES_PER_BLOCK)
+    {
+      unsigned block = (firstIndex + i) / VALUES_PER_BLOCK;
+
+      __m128i x0 = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(block)), _mm_set_epi32(3, 2, 1, 0));
+      __m128i x1 = _mm_set1_epi32(static_cast<int>(counter_[0]));
+      __m128i x2 = _mm_set1_epi32(static_cast<int>(counter_[1]));
+      __m128i x3 = _mm_set1_epi32(static_cast<int>(counter_[2]));
+      __m128i k0 = _mm_set1_epi32(static_cast<int>(key_[0]));
+      __m128i k1 = _mm_set1_epi32(static_cast<int>(key_[1]));
+
+      for (unsigned round = 0; round < ROUNDS; ++round)
+      {
+        __m128i high0, low0, high1, low1;
+
+        MultiplyHiLo(x0, m0, high0, low0);
+        MultiplyHiLo(x2, m1, high1, low1);
+
+        x0 = _mm_xor_si128(_mm_xor_si128(high1, x1), k0);
+        x1 = low1;
+        x2 = _mm_xor_si128(_mm_xor_si128(high0, x3), k1);
+        x3 = low0;
+
+        k0 = _mm_add_epi32(k0, _mm_set1_epi32(static_cast<int>(PHILOX_W0)));
+        k1 = _mm_add_epi32(k1, _mm_set1_epi32(static_cast<int>(PHILOX_W1)));
+      }
+
+      // lanes hold blocks and registers hold words, so transpose back to stream order
+      __m128 v0 = ToRange(x0, minimum, range);
+      __m128 v1 = ToRange(x1, minimum, range);
+      __m128 v2 = ToRange(x2, minimum, range);
+      __m128 v3 = ToRange(x3, minimum, range);
+
+      _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+      _mm_storeu_ps(values + i, v0);
+      _mm_storeu_ps(values + i + 4, v1);
+      _mm_storeu_ps(values + i + 8, v2);
+      _mm_storeu_ps(values + i + 12, v3);
+    }
+
+    FillFloatsScalar(values + i, firstIndex + i, count - i, min, max);
+  }
+#else
+  void CounterRandom::FillFloatsSSE2(float* values, unsigned firstIndex, unsigned count, float min, float max) const
+  {
+    FillFloatsScalar(values, firstIndex, count, min, max);
+  }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+/* ======================================================================== */
+/*!
+ * \file            CounterRandom.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Counter-based random number generator based on Philox4x32-10. Each value
+   is worked out from a key and the value's index alone, with no state
+   carried from one value to the next. Values can be made in any order and
+   on any thread and still come out the same, which is what spawning needs
+   to run in parallel and replay the same way every time.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CounterRandom_BARRAGE_H
+#define CounterRandom_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+
+namespace Barrage
+{
+  //! Random number generator based on Philox4x32-10
+  class CounterRandom
+  {
+    public:
+      static constexpr unsigned VALUES_PER_BLOCK = 4;   //!< Values made by one run of the generator
+      static constexpr unsigned ROUNDS = 10;            //!< Philox rounds per block
+
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs a stream of random values. Streams with any
+          difference in their arguments are unrelated.
+
+        \param seed
+          The 64-bit seed, usually the seed of the space's generator.
+
+        \param tick
+          The tick the values are made on.
+
+        \param stream
+          Tells apart streams made on the same tick, such as one per
+          spawner.
+
+        \param rule
+          Tells apart streams for different users of the same stream
+          number, such as one per spawn rule.
+      */
+      /**************************************************************/
+      CounterRandom(unsigned long long seed, unsigned tick, unsigned stream, unsigned rule);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets a value from the stream.
+
+        \param index
+          The place of the value in the stream.
+
+        \return
+          Returns a random 32-bit number.
+      */
+      /**************************************************************/
+      unsigned Value(unsigned index) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets a value from the stream as a float in [0, 1).
+
+        \param index
+          The place of the value in the stream.
+
+        \return
+          Returns a random float in [0, 1), a multiple of 2^-24.
+      */
+      /**************************************************************/
+      float Float(unsigned index) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets a value from the stream as a float between min and
+          max.
+
+        \param index
+          The place of the value in the stream.
+
+        \param min
+          The minimum value of the range.
+
+        \param max
+          The maximum value of the range.
+
+        \return
+          Returns min + Float(index) * (max - min).
+      */
+      /**************************************************************/
+      float RangeFloat(unsigned index, float min, float max) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Fills an array with RangeFloat() for a run of indices.
+
+        \param values
+          Receives the random floats.
+
+        \param firstIndex
+          The place in the stream of the first value.
+
+        \param count
+          The number of values.
+
+        \param min
+          The minimum value of the range.
+
+        \param max
+          The maximum value of the range.
+      */
+      /**************************************************************/
+      void FillFloats(float* values, unsigned firstIndex, unsigned count, float min, float max) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reference version of FillFloats() without SIMD.
+      */
+      /**************************************************************/
+      void FillFloatsScalar(float* values, unsigned firstIndex, unsigned count, float min, float max) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          SSE2 version of FillFloats(), four blocks at a time. Gives
+          exactly the same values as the scalar version. Falls back
+          to the scalar version where SSE2 isn't available.
+      */
+      /**************************************************************/
+      void FillFloatsSSE2(float* values, unsigned firstIndex, unsigned count, float min, float max) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Hashes a name into a stream or rule number. Unlike
+          std::hash, the result is the same on every platform.
+
+        \param name
+          The name to hash.
+
+        \return
+          Returns the 32-bit FNV-1a hash of the name.
+      */
+      /**************************************************************/
+      static unsigned Hash(const std::string& name);
+
+    private:
+      /**************************************************************/
+      /*!
+        \brief
+          Runs the generator on one block of the stream.
+
+        \param block
+          The block number. Block n holds the values at indices
+          4n to 4n + 3.
+
+        \param result
+          Receives the block's four values.
+      */
+      /**************************************************************/
+      void GenerateBlock(unsigned block, unsigned result[VALUES_PER_BLOCK]) const;
+
+    private:
+      unsigned key_[2];       //!< The seed, split into two 32-bit halves
+      unsigned counter_[3];   //!< Tick, stream and rule (the block number fills the fourth word)
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // CounterRandom_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
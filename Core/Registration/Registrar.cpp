@@ -58,10 +58,12 @@ namespace Barrage
       .property("capacity", &PoolArchetype::capacity_)
       .property("componentArrayNames", &PoolArchetype::componentArrayNames_)
       .property("components", &PoolArchetype::components_)
+      .property("maxCapacity", &PoolArchetype::maxCapacity_)
       .property("name", &PoolArchetype::name_)
       .property("spawnArchetypes", &PoolArchetype::spawnArchetypes_)
       .property("startingObjects", &PoolArchetype::startingObjects_)
       .property("tags", &PoolArchetype::tags_)
+      .property("unorderedDestruction", &PoolArchetype::unorderedDestruction_)
       ;
 
     rttr::registration::class_<ObjectArchetype>("ObjectArchetype")
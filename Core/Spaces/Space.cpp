@@ -21,6 +21,7 @@ namespace Barrage
     actionManager_(),
     objectManager_(*this),
     rng_(),
+    tick_(0),
     paused_(false),
     visible_(true),
     allowSceneChangesDuringUpdate_(true),
@@ -37,6 +38,7 @@ namespace Barrage
       actionManager_.Update();
       objectManager_.Update();
       isUpdating_ = false;
+      ++tick_;
 
       if (!queuedScene_.empty())
       {
@@ -69,6 +71,11 @@ namespace Barrage
     return rng_;
   }
 
+  unsigned Space::GetTick() const
+  {
+    return tick_;
+  }
+
   void Space::SetScene(const std::string& name)
   {
     if (isUpdating_)
@@ -100,6 +107,7 @@ namespace Barrage
     objectManager_.SubscribePools();
 
     rng_.SetSeed();
+    tick_ = 0;
   }
 
   void Space::SetPaused(bool isPaused)
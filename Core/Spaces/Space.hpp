@@ -44,6 +44,8 @@ namespace Barrage
 
       Random& RNG();
 
+      unsigned GetTick() const;
+
       void SetScene(const std::string& name);
 
       void SetPaused(bool isPaused);
@@ -60,6 +62,7 @@ namespace Barrage
       ActionManager actionManager_;
       ObjectManager objectManager_;
       Random rng_;
+      unsigned tick_;
       bool paused_;
       bool visible_;
       bool allowSceneChangesDuringUpdate_;
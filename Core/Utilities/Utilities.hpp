@@ -16,6 +16,7 @@
 #define Utilities_BARRAGE_H
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
 #include <set>
 #include <string>
 
@@ -129,6 +130,99 @@ namespace Barrage
   /**************************************************************/
   template <typename T>
   T Lerp(T min, T max, float factor);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Counts the zero bits below the lowest set bit of a value.
+      Used to walk the set bits of a bitmask.
+
+    \param value
+      The value to scan. Must not be zero.
+
+    \return
+      Returns the index of the lowest set bit.
+  */
+  /**************************************************************/
+  inline unsigned CountTrailingZeros(uint64_t value);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Counts the zero bits above the highest set bit of a value.
+
+    \param value
+      The value to scan. Must not be zero.
+
+    \return
+      Returns 63 minus the index of the highest set bit.
+  */
+  /**************************************************************/
+  inline unsigned CountLeadingZeros(uint64_t value);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Counts the set bits of a value (population count).
+
+    \param value
+      The value to count.
+
+    \return
+      Returns the number of set bits.
+  */
+  /**************************************************************/
+  inline unsigned CountSetBits(uint64_t value);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Finds the first bit in [begin, end) of a bitset that has the
+      given value. Bit i is bit i % 64 of word i / 64. Skips whole
+      words at a time.
+
+    \param words
+      The bitset.
+
+    \param begin
+      Index of the first bit to check.
+
+    \param end
+      One past the index of the last bit to check.
+
+    \param value
+      The bit value to look for.
+
+    \return
+      Returns the index of the bit, or end if there isn't one.
+  */
+  /**************************************************************/
+  inline unsigned FindNextBit(const uint64_t* words, unsigned begin, unsigned end, bool value);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Finds the last bit in [begin, end) of a bitset that has the
+      given value, scanning backwards from end.
+
+    \param words
+      The bitset.
+
+    \param begin
+      Index of the first bit to check.
+
+    \param end
+      One past the index of the last bit to check.
+
+    \param value
+      The bit value to look for.
+
+    \return
+      Returns one past the index of the bit, or begin if there
+      isn't one.
+  */
+  /**************************************************************/
+  inline unsigned FindPreviousBit(const uint64_t* words, unsigned begin, unsigned end, bool value);
 }
 
 #include "Utilities.tpp"
@@ -21,6 +21,10 @@
 //  ===========================================================================
 #include <math.h>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
 namespace Barrage
 {
   template <typename T>
@@ -50,6 +54,87 @@ namespace Barrage
 
     return min + static_cast<T>((max - min) * lerpFactor);
   }
+
+  inline unsigned CountTrailingZeros(uint64_t value)
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+  }
+
+  inline unsigned CountLeadingZeros(uint64_t value)
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63 - static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_clzll(value));
+#endif
+  }
+
+  inline unsigned CountSetBits(uint64_t value)
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    // no popcnt instruction is assumed, so count the bits in parallel
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<unsigned>((value * 0x0101010101010101ull) >> 56);
+#else
+    return static_cast<unsigned>(__builtin_popcountll(value));
+#endif
+  }
+
+  inline unsigned FindNextBit(const uint64_t* words, unsigned begin, unsigned end, bool value)
+  {
+    const uint64_t flip = value ? 0 : ~uint64_t(0);
+
+    while (begin < end)
+    {
+      // mask off the bits below begin in its word
+      uint64_t bits = (words[begin / 64] ^ flip) & (~uint64_t(0) << (begin % 64));
+
+      if (bits)
+      {
+        unsigned index = begin / 64 * 64 + CountTrailingZeros(bits);
+
+        return index < end ? index : end;
+      }
+
+      begin = begin / 64 * 64 + 64;
+    }
+
+    return end;
+  }
+
+  inline unsigned FindPreviousBit(const uint64_t* words, unsigned begin, unsigned end, bool value)
+  {
+    const uint64_t flip = value ? 0 : ~uint64_t(0);
+
+    while (end > begin)
+    {
+      unsigned last = end - 1;
+
+      // mask off the bits above last in its word
+      uint64_t bits = (words[last / 64] ^ flip) & (~uint64_t(0) >> (63 - last % 64));
+
+      if (bits)
+      {
+        unsigned index = last / 64 * 64 + 63 - CountLeadingZeros(bits);
+
+        return index >= begin ? index + 1 : begin;
+      }
+
+      end = last / 64 * 64;
+    }
+
+    return begin;
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,68 @@
+/* ======================================================================== */
+/*!
+ * \file            EditMaxCapacity.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Edits the max capacity of a pool archetype.
+ */
+ /* ======================================================================== */
+
+#include "EditMaxCapacity.hpp"
+#include <Editor.hpp>
+
+namespace Barrage
+{
+  EditMaxCapacity::EditMaxCapacity(
+    const std::string& sceneName,
+    const std::string& poolName,
+    unsigned newValue,
+    bool chainUndo) :
+    Command("Changed max capacity of " + poolName + ".", chainUndo),
+    sceneName_(sceneName),
+    poolName_(poolName),
+    newValue_(newValue),
+    oldValue_(0)
+  {
+  }
+
+  bool EditMaxCapacity::Execute()
+  {
+    Scene* scene = Engine::Get().Scenes().GetScene(sceneName_);
+
+    if (scene == nullptr || scene->poolArchetypes_.count(poolName_) == 0)
+    {
+      return false;
+    }
+
+    PoolArchetype& poolArchetype = scene->poolArchetypes_.at(poolName_);
+
+    if (poolArchetype.maxCapacity_ == newValue_)
+    {
+      return false;
+    }
+
+    oldValue_ = poolArchetype.maxCapacity_;
+    poolArchetype.maxCapacity_ = newValue_;
+
+    return true;
+  }
+
+  void EditMaxCapacity::Undo()
+  {
+    Scene* scene = Engine::Get().Scenes().GetScene(sceneName_);
+    PoolArchetype& poolArchetype = scene->poolArchetypes_.at(poolName_);
+
+    poolArchetype.maxCapacity_ = oldValue_;
+  }
+
+  void EditMaxCapacity::Redo()
+  {
+    Scene* scene = Engine::Get().Scenes().GetScene(sceneName_);
+    PoolArchetype& poolArchetype = scene->poolArchetypes_.at(poolName_);
+
+    poolArchetype.maxCapacity_ = newValue_;
+  }
+}
\ No newline at end of file
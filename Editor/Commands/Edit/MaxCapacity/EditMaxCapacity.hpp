@@ -0,0 +1,91 @@
+/* ======================================================================== */
+/*!
+ * \file            EditMaxCapacity.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Edits the max capacity of a pool archetype.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef EditMaxCapacity_BARRAGE_H
+#define EditMaxCapacity_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <Commands/Command.hpp>
+#include <rttr/variant.h>
+
+namespace Barrage
+{
+  //! Edits the max capacity of a pool archetype
+  class EditMaxCapacity : public Command
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs the command.
+
+        \param sceneName
+          The scene containing the relevant pool.
+
+        \param poolName
+          The pool archetype to edit.
+
+        \param newValue
+          The number of objects the pool may grow to hold.
+
+        \param chainUndo
+          Whether undo chaining is enabled for this command.
+      */
+      /**************************************************************/
+      EditMaxCapacity(
+        const std::string& sceneName,
+        const std::string& poolName,
+        unsigned newValue,
+        bool chainUndo);
+
+    private:
+      /**************************************************************/
+      /*!
+        \brief
+          Writes the new value to the pool archetype.
+
+        \return
+          Returns true if the command was successful, returns false
+          if the command had no effect.
+      */
+      /**************************************************************/
+      bool Execute() override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Undoes the command.
+      */
+      /**************************************************************/
+      void Undo() override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Redoes the command.
+      */
+      /**************************************************************/
+      void Redo() override;
+
+    private:
+      std::string sceneName_;
+      std::string poolName_;
+
+      unsigned newValue_;
+      unsigned oldValue_;
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // EditMaxCapacity_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
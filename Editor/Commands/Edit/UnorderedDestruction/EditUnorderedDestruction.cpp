@@ -0,0 +1,68 @@
+/* ======================================================================== */
+/*!
+ * \file            EditUnorderedDestruction.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Edits whether a pool archetype uses unordered destruction.
+ */
+ /* ======================================================================== */
+
+#include "EditUnorderedDestruction.hpp"
+#include <Editor.hpp>
+
+namespace Barrage
+{
+  EditUnorderedDestruction::EditUnorderedDestruction(
+    const std::string& sceneName,
+    const std::string& poolName,
+    bool newValue,
+    bool chainUndo) :
+    Command("Changed destruction mode of " + poolName + ".", chainUndo),
+    sceneName_(sceneName),
+    poolName_(poolName),
+    newValue_(newValue),
+    oldValue_(false)
+  {
+  }
+
+  bool EditUnorderedDestruction::Execute()
+  {
+    Scene* scene = Engine::Get().Scenes().GetScene(sceneName_);
+
+    if (scene == nullptr || scene->poolArchetypes_.count(poolName_) == 0)
+    {
+      return false;
+    }
+
+    PoolArchetype& poolArchetype = scene->poolArchetypes_.at(poolName_);
+
+    if (poolArchetype.unorderedDestruction_ == newValue_)
+    {
+      return false;
+    }
+
+    oldValue_ = poolArchetype.unorderedDestruction_;
+    poolArchetype.unorderedDestruction_ = newValue_;
+
+    return true;
+  }
+
+  void EditUnorderedDestruction::Undo()
+  {
+    Scene* scene = Engine::Get().Scenes().GetScene(sceneName_);
+    PoolArchetype& poolArchetype = scene->poolArchetypes_.at(poolName_);
+
+    poolArchetype.unorderedDestruction_ = oldValue_;
+  }
+
+  void EditUnorderedDestruction::Redo()
+  {
+    Scene* scene = Engine::Get().Scenes().GetScene(sceneName_);
+    PoolArchetype& poolArchetype = scene->poolArchetypes_.at(poolName_);
+
+    poolArchetype.unorderedDestruction_ = newValue_;
+  }
+}
\ No newline at end of file
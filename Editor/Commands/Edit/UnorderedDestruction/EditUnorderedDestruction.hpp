@@ -0,0 +1,91 @@
+/* ======================================================================== */
+/*!
+ * \file            EditUnorderedDestruction.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Edits whether a pool archetype uses unordered destruction.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef EditUnorderedDestruction_BARRAGE_H
+#define EditUnorderedDestruction_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <Commands/Command.hpp>
+#include <rttr/variant.h>
+
+namespace Barrage
+{
+  //! Edits whether a pool archetype uses unordered destruction
+  class EditUnorderedDestruction : public Command
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs the command.
+
+        \param sceneName
+          The scene containing the relevant pool.
+
+        \param poolName
+          The pool archetype to edit.
+
+        \param newValue
+          True if the pool should use unordered destruction.
+
+        \param chainUndo
+          Whether undo chaining is enabled for this command.
+      */
+      /**************************************************************/
+      EditUnorderedDestruction(
+        const std::string& sceneName,
+        const std::string& poolName,
+        bool newValue,
+        bool chainUndo);
+
+    private:
+      /**************************************************************/
+      /*!
+        \brief
+          Writes the new value to the pool archetype.
+
+        \return
+          Returns true if the command was successful, returns false
+          if the command had no effect.
+      */
+      /**************************************************************/
+      bool Execute() override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Undoes the command.
+      */
+      /**************************************************************/
+      void Undo() override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Redoes the command.
+      */
+      /**************************************************************/
+      void Redo() override;
+
+    private:
+      std::string sceneName_;
+      std::string poolName_;
+
+      bool newValue_;
+      bool oldValue_;
+  };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // EditUnorderedDestruction_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -21,6 +21,8 @@
 
 #include "Commands/Delete/Tag/DeleteTag.hpp"
 #include "Commands/Edit/Capacity/EditCapacity.hpp"
+#include "Commands/Edit/MaxCapacity/EditMaxCapacity.hpp"
+#include "Commands/Edit/UnorderedDestruction/EditUnorderedDestruction.hpp"
 
 namespace Barrage
 {
@@ -76,6 +78,60 @@ namespace Barrage
       ));
     }
 
+    unsigned old_max_capacity_value = poolArchetype.maxCapacity_;
+    rttr::variant max_capacity_value = old_max_capacity_value;
+    DataWidget::DataObject max_capacity_object("Max Capacity", max_capacity_value);
+
+    DataWidget::Use(max_capacity_object);
+    ImGui::Spacing();
+
+    if (max_capacity_object.ValueWasSet())
+    {
+      unsigned new_value = max_capacity_object.GetValue<unsigned>();
+
+      EditorData& editorData = Editor::Get().Data();
+      Editor::Get().Command().Send(std::make_shared<EditMaxCapacity>(
+        editorData.selectedScene_,
+        editorData.selectedPool_,
+        new_value,
+        max_capacity_object.ChainUndoEnabled()
+      ));
+    }
+
+    if (Editor::Get().Data().gamePlaying_)
+    {
+      Space* space = Engine::Get().Spaces().GetSpace(Editor::Get().Data().editorSpace_);
+
+      if (space && space->Objects().pools_.count(Editor::Get().Data().selectedPool_))
+      {
+        Pool& pool = space->Objects().pools_.at(Editor::Get().Data().selectedPool_);
+
+        ImGui::Text("Growths: %u", pool.GrowthCount());
+        ImGui::Text("Dropped Spawns: %u", pool.DroppedSpawnCount());
+        ImGui::Spacing();
+      }
+    }
+
+    bool old_unordered_value = poolArchetype.unorderedDestruction_;
+    rttr::variant unordered_value = old_unordered_value;
+    DataWidget::DataObject unordered_object("Unordered Destruction", unordered_value);
+
+    DataWidget::Use(unordered_object);
+    ImGui::Spacing();
+
+    if (unordered_object.ValueWasSet())
+    {
+      bool new_value = unordered_object.GetValue<bool>();
+
+      EditorData& editorData = Editor::Get().Data();
+      Editor::Get().Command().Send(std::make_shared<EditUnorderedDestruction>(
+        editorData.selectedScene_,
+        editorData.selectedPool_,
+        new_value,
+        unordered_object.ChainUndoEnabled()
+      ));
+    }
+
     if (ImGui::CollapsingHeader("Tags"))
     {
       StringSet& tags = poolArchetype.tags_;
@@ -27,10 +27,13 @@ namespace Barrage
 
     BehaviorState RotateDirection::Execute(BehaviorNodeInfo& info)
     {
-      Velocity& velocity = info.pool_.GetComponentArray<Velocity>("Velocity").Data(info.objectIndex_);
+      VelocityArray& velocities = info.pool_.GetComponentArray<Velocity>();
+      Velocity velocity = velocities.Get(info.objectIndex_);
 
       velocity.Rotate(data_.angle_.value_);
 
+      velocities.Set(info.objectIndex_, velocity);
+
       return BehaviorState::Success();
     }
 
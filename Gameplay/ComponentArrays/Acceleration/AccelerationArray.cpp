@@ -0,0 +1,31 @@
+/* ======================================================================== */
+/*!
+ * \file            AccelerationArray.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The Acceleration component keeps track of how fast an object's speed
+   changes. The movement system applies it to the object's velocity in the
+   same pass that moves the object.
+ */
+ /* ======================================================================== */
+
+#include "AccelerationArray.hpp"
+
+namespace Barrage
+{
+  Acceleration::Acceleration() :
+    a_(0.0f)
+  {
+  }
+
+  void Acceleration::Reflect()
+  {
+    rttr::registration::class_<Acceleration>("Acceleration")
+      .constructor<>() (rttr::policy::ctor::as_object)
+      .property("a", &Acceleration::a_)
+      ;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+/* ======================================================================== */
+/*!
+ * \file            AccelerationArray.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The Acceleration component keeps track of how fast an object's speed
+   changes. The movement system applies it to the object's velocity in the
+   same pass that moves the object.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef AccelerationArray_BARRAGE_H
+#define AccelerationArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Components/ComponentArray.hpp"
+
+namespace Barrage
+{
+  //!< Change in speed of a game object
+  struct Acceleration
+  {
+    float a_; //!< Change in speed per tick (negative values slow the object down)
+
+    Acceleration();
+
+    static void Reflect();
+  };
+
+  typedef Barrage::ComponentArrayT<Acceleration> AccelerationArray;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // AccelerationArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
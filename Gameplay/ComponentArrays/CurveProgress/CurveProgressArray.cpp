@@ -0,0 +1,50 @@
+/* ======================================================================== */
+/*!
+ * \file            CurveProgressArray.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The Curve Progress component keeps track of how far an object has
+   traveled along its pool's movement curve. Curve progress arrays are
+   split into distance and speed streams, so the movement system can hand
+   every distance in a pool to the curve lookup at once.
+ */
+ /* ======================================================================== */
+
+#include "CurveProgressArray.hpp"
+
+namespace Barrage
+{
+  CurveProgress::CurveProgress() :
+    distance_(0.0f),
+    speed_(0.0f)
+  {
+  }
+
+  void ComponentFields<CurveProgress>::Write(const CurveProgress& value, float* const* fields, unsigned index)
+  {
+    fields[DISTANCE][index] = value.distance_;
+    fields[SPEED][index] = value.speed_;
+  }
+
+  CurveProgress ComponentFields<CurveProgress>::Read(const float* const* fields, unsigned index)
+  {
+    CurveProgress value;
+
+    value.distance_ = fields[DISTANCE][index];
+    value.speed_ = fields[SPEED][index];
+
+    return value;
+  }
+
+  void CurveProgress::Reflect()
+  {
+    rttr::registration::class_<CurveProgress>("CurveProgress")
+      .constructor<>() (rttr::policy::ctor::as_object)
+      .property("distance", &CurveProgress::distance_)
+      .property("speed", &CurveProgress::speed_)
+      ;
+  }
+}
\ No newline at end of file
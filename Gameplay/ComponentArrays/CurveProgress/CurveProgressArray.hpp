@@ -0,0 +1,65 @@
+/* ======================================================================== */
+/*!
+ * \file            CurveProgressArray.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The Curve Progress component keeps track of how far an object has
+   traveled along its pool's movement curve. Curve progress arrays are
+   split into distance and speed streams, so the movement system can hand
+   every distance in a pool to the curve lookup at once.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CurveProgressArray_BARRAGE_H
+#define CurveProgressArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Components/SplitComponentArray.hpp"
+
+namespace Barrage
+{
+  //!< How far along its pool's movement curve an object is
+  struct CurveProgress
+  {
+    float distance_; //!< Distance traveled along the curve in world units
+    float speed_;    //!< Distance traveled along the curve per tick
+
+    CurveProgress();
+
+    static void Reflect();
+  };
+
+  //!< Splits curve progress into distance and speed streams
+  template <>
+  struct ComponentFields<CurveProgress>
+  {
+    enum Field : unsigned
+    {
+      DISTANCE,
+      SPEED,
+      NUM_FIELDS
+    };
+
+    static void Write(const CurveProgress& value, float* const* fields, unsigned index);
+
+    static CurveProgress Read(const float* const* fields, unsigned index);
+  };
+
+  typedef ComponentFields<CurveProgress> CurveProgressFields;
+
+  template <>
+  struct ComponentArrayStorage<CurveProgress>
+  {
+    using Type = SplitComponentArrayT<CurveProgress>; //!< Array type used for the component
+  };
+
+  typedef Barrage::SplitComponentArrayT<CurveProgress> CurveProgressArray;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // CurveProgressArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
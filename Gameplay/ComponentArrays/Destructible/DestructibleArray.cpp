@@ -6,14 +6,220 @@
  * \par             david.n.cruse\@gmail.com
 
  * \brief
-
+   The Destructible component keeps track of whether an object is marked
+   for destruction. Destructible arrays store one bit per object, so
+   systems can mark whole blocks of objects with a single write and the
+   destruction pass can skip 64 live objects at a time.
  */
  /* ======================================================================== */
 
 #include "DestructibleArray.hpp"
+#include "Utilities/Utilities.hpp"
+
+#include <algorithm>
 
 namespace Barrage
 {
+  namespace
+  {
+    unsigned GetWordCount(unsigned capacity)
+    {
+      return (capacity + 63) / 64;
+    }
+  }
+
+  DestructibleArray::DestructibleArray(unsigned capacity) :
+    ComponentArray(capacity),
+    words_(GetWordCount(capacity), 0)
+  {
+  }
+
+  std::shared_ptr<ComponentArray> DestructibleArray::Clone() const
+  {
+    return std::make_shared<DestructibleArray>(*this);
+  }
+
+  void DestructibleArray::CopyToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex)
+  {
+    const DestructibleArray& source_derived = static_cast<const DestructibleArray&>(source);
+
+    Set(recipientIndex, source_derived.Get(sourceIndex));
+  }
+
+  void DestructibleArray::FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count)
+  {
+    const DestructibleArray& source_derived = static_cast<const DestructibleArray&>(source);
+
+    FillBits(recipientIndex, recipientIndex + count, source_derived.IsDestroyed(sourceIndex));
+  }
+
+  void DestructibleArray::CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count)
+  {
+    const DestructibleArray& source_derived = static_cast<const DestructibleArray&>(source);
+
+    if (count == 0 || (&source_derived == this && sourceIndex == recipientIndex))
+    {
+      return;
+    }
+
+    // copy in the direction that doesn't overwrite flags before they're read
+    if (&source_derived != this || recipientIndex < sourceIndex)
+    {
+      for (unsigned i = 0; i < count; ++i)
+      {
+        Set(recipientIndex + i, Destructible(source_derived.IsDestroyed(sourceIndex + i)));
+      }
+    }
+    else
+    {
+      for (unsigned i = count; i > 0; --i)
+      {
+        Set(recipientIndex + i - 1, Destructible(IsDestroyed(sourceIndex + i - 1)));
+      }
+    }
+  }
+
+  void DestructibleArray::SetCapacity(unsigned capacity, unsigned numObjects)
+  {
+    unsigned numKept = std::min(numObjects, std::min(capacity, capacity_));
+
+    words_.resize(GetWordCount(capacity), 0);
+    FillBits(numKept, static_cast<unsigned>(words_.size()) * 64, false);
+
+    capacity_ = capacity;
+  }
+
+  void DestructibleArray::HandleDestructions(const DestructionPlan& plan)
+  {
+    FillBits(0, plan.endIndex_, false);
+  }
+
+  Destructible DestructibleArray::Get(unsigned index) const
+  {
+    return Destructible(IsDestroyed(index));
+  }
+
+  void DestructibleArray::Set(unsigned index, const Destructible& value)
+  {
+    uint64_t bit = uint64_t(1) << (index % 64);
+
+    if (value.destroyed_)
+    {
+      words_[index / 64] |= bit;
+    }
+    else
+    {
+      words_[index / 64] &= ~bit;
+    }
+  }
+
+  bool DestructibleArray::IsDestroyed(unsigned index) const
+  {
+    return (words_[index / 64] >> (index % 64)) & 1;
+  }
+
+  void DestructibleArray::Destroy(unsigned index)
+  {
+    words_[index / 64] |= uint64_t(1) << (index % 64);
+  }
+
+  void DestructibleArray::DestroyRange(unsigned begin, unsigned end)
+  {
+    FillBits(begin, end, true);
+  }
+
+  void DestructibleArray::DestroyMasked(unsigned begin, const uint64_t* mask, unsigned count)
+  {
+    unsigned shift = begin % 64;
+    unsigned firstWord = begin / 64;
+    unsigned numMaskWords = GetWordCount(count);
+
+    for (unsigned word = 0; word < numMaskWords; ++word)
+    {
+      uint64_t bits = mask[word];
+
+      // drop any bits past count in the last word
+      if (word == numMaskWords - 1 && count % 64)
+      {
+        bits &= ~uint64_t(0) >> (64 - count % 64);
+      }
+
+      if (bits == 0)
+      {
+        continue;
+      }
+
+      words_[firstWord + word] |= bits << shift;
+
+      if (shift && (bits >> (64 - shift)))
+      {
+        words_[firstWord + word + 1] |= bits >> (64 - shift);
+      }
+    }
+  }
+
+  unsigned DestructibleArray::FindFirstDestroyed(unsigned end) const
+  {
+    return FindNextBit(words_.data(), 0, end, true);
+  }
+
+  unsigned DestructibleArray::CountDestroyed(unsigned end) const
+  {
+    unsigned count = 0;
+
+    for (unsigned word = 0; word < end / 64; ++word)
+    {
+      count += CountSetBits(words_[word]);
+    }
+
+    if (end % 64)
+    {
+      count += CountSetBits(words_[end / 64] & (~uint64_t(0) >> (64 - end % 64)));
+    }
+
+    return count;
+  }
+
+  const uint64_t* DestructibleArray::GetBits() const
+  {
+    return words_.data();
+  }
+
+  rttr::variant DestructibleArray::GetRTTRValue(int index) const
+  {
+    rttr::variant value = Get(index);
+
+    return value;
+  }
+
+  void DestructibleArray::SetRTTRValue(const rttr::variant& value, int index)
+  {
+    if (value.get_type() != rttr::type::get<Destructible>())
+    {
+      return;
+    }
+
+    Set(index, value.get_value<Destructible>());
+  }
+
+  void DestructibleArray::FillBits(unsigned begin, unsigned end, bool value)
+  {
+    const uint64_t fill = value ? ~uint64_t(0) : 0;
+
+    while (begin < end)
+    {
+      unsigned word = begin / 64;
+      unsigned wordEnd = std::min(end, word * 64 + 64);
+
+      // bits [begin % 64, wordEnd - word * 64) of this word
+      uint64_t bits = (~uint64_t(0) << (begin % 64)) & (~uint64_t(0) >> (word * 64 + 64 - wordEnd));
+
+      words_[word] = (words_[word] & ~bits) | (fill & bits);
+
+      begin = wordEnd;
+    }
+  }
+
   void DestructibleReflect()
   {
     rttr::registration::class_<Destructible>("Destructible")
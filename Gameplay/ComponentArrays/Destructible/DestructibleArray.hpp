@@ -7,7 +7,9 @@
 
  * \brief
    The Destructible component keeps track of whether an object is marked
-   for destruction.
+   for destruction. Destructible arrays store one bit per object, so
+   systems can mark whole blocks of objects with a single write and the
+   destruction pass can skip 64 live objects at a time.
  */
 /* ======================================================================== */
 
@@ -18,9 +20,305 @@
 
 #include "Objects/Components/ComponentArray.hpp"
 
+#include <cstdint>
+#include <vector>
+
 namespace Barrage
 {
-  typedef ComponentArrayT<Destructible> DestructibleArray;
+  //! Component array that packs each object's destroyed flag into a bitset
+  class DestructibleArray : public ComponentArray
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Constructs a destructible array with the given capacity. No
+          object starts out destroyed.
+
+        \param capacity
+          The number of objects the array holds.
+      */
+      /**************************************************************/
+      DestructibleArray(unsigned capacity = 1);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Creates a component array that's a deep copy of this one.
+
+        \return
+          Returns a pointer to the new component array.
+      */
+      /**************************************************************/
+      std::shared_ptr<ComponentArray> Clone() const override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies an object's flag from some source destructible array
+          to an object in this array.
+
+        \param source
+          The destructible array holding the flag to copy from. The
+          source may be this array.
+
+        \param sourceIndex
+          The index of the flag to copy from.
+
+        \param recipientIndex
+          The index of the flag in this array to copy to.
+      */
+      /**************************************************************/
+      void CopyToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies a single flag from some source destructible array to
+          every object in the range [recipientIndex,
+          recipientIndex + count) of this array, a word at a time.
+
+        \param source
+          The destructible array holding the flag to copy from. The
+          source may be this array.
+
+        \param sourceIndex
+          The index of the flag to copy from.
+
+        \param recipientIndex
+          The index of the first object in this array to copy to.
+
+        \param count
+          The number of flags to write.
+      */
+      /**************************************************************/
+      void FillToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Copies the flags [sourceIndex, sourceIndex + count) of some
+          source destructible array to the range
+          [recipientIndex, recipientIndex + count) of this array.
+
+        \param source
+          The destructible array holding the flags to copy from. The
+          source may be this array, and the ranges may overlap.
+
+        \param sourceIndex
+          The index of the first flag to copy from.
+
+        \param recipientIndex
+          The index of the first flag in this array to copy to.
+
+        \param count
+          The number of flags to copy.
+      */
+      /**************************************************************/
+      void CopyRangeToThis(const ComponentArray& source, unsigned sourceIndex, unsigned recipientIndex, unsigned count) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Resizes the bitset. The first numObjects flags are kept and
+          the rest are cleared.
+
+        \param capacity
+          The new capacity to set.
+
+        \param numObjects
+          The number of objects whose flags should be kept.
+      */
+      /**************************************************************/
+      void SetCapacity(unsigned capacity, unsigned numObjects) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Applies a destruction plan to the array. Every object that
+          survives a destruction pass is alive, so this just clears
+          the flags of every object the plan covered.
+
+        \param plan
+          The moves that pack the pool's alive objects.
+      */
+      /**************************************************************/
+      void HandleDestructions(const DestructionPlan& plan) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reads the component at a given index in the array.
+
+        \param index
+          The index of the component to read.
+
+        \return
+          Returns a copy of the component.
+      */
+      /**************************************************************/
+      Destructible Get(unsigned index) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Writes the component at a given index in the array.
+
+        \param index
+          The index of the component to write.
+
+        \param value
+          The value to write.
+      */
+      /**************************************************************/
+      void Set(unsigned index, const Destructible& value);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Checks whether an object is marked for destruction.
+
+        \param index
+          The index of the object.
+
+        \return
+          Returns true if the object is marked for destruction.
+      */
+      /**************************************************************/
+      bool IsDestroyed(unsigned index) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Marks an object for destruction.
+
+        \param index
+          The index of the object.
+      */
+      /**************************************************************/
+      void Destroy(unsigned index);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Marks every object in [begin, end) for destruction, a word
+          at a time.
+
+        \param begin
+          The index of the first object.
+
+        \param end
+          One past the index of the last object.
+      */
+      /**************************************************************/
+      void DestroyRange(unsigned begin, unsigned end);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Marks objects for destruction from a bitmask. Bit i of the
+          mask (bit i % 64 of word i / 64) marks object begin + i.
+
+          Jobs that call this on different ranges of the same array
+          at the same time must start their ranges on multiples of
+          64, so no two jobs write the same word.
+
+        \param begin
+          The index of the object covered by the first bit of the
+          mask.
+
+        \param mask
+          The bitmask, holding at least (count + 63) / 64 words.
+
+        \param count
+          The number of bits in the mask.
+      */
+      /**************************************************************/
+      void DestroyMasked(unsigned begin, const uint64_t* mask, unsigned count);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Finds the first object marked for destruction.
+
+        \param end
+          One past the index of the last object to check.
+
+        \return
+          Returns the index of the object, or end if none are marked.
+      */
+      /**************************************************************/
+      unsigned FindFirstDestroyed(unsigned end) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Counts the objects marked for destruction.
+
+        \param end
+          One past the index of the last object to count.
+
+        \return
+          Returns the number of marked objects in [0, end).
+      */
+      /**************************************************************/
+      unsigned CountDestroyed(unsigned end) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the bitset (bit i % 64 of word i / 64 is object i).
+
+        \return
+          Returns a pointer to the first word.
+      */
+      /**************************************************************/
+      const uint64_t* GetBits() const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets an rttr::variant representation of the component at
+          some index. Should not generally be used except for
+          serialization/the editor.
+
+        \param index
+          The index of the component to get.
+
+        \return
+          Returns the value of the component as an rttr::variant.
+      */
+      /**************************************************************/
+      rttr::variant GetRTTRValue(int index) const override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets the component value at some index using an rttr::variant.
+          Should not generally be used except for serialization or
+          the editor.
+      */
+      /**************************************************************/
+      void SetRTTRValue(const rttr::variant& value, int index) override;
+
+    private:
+      /**************************************************************/
+      /*!
+        \brief
+          Sets or clears every flag in [begin, end).
+      */
+      /**************************************************************/
+      void FillBits(unsigned begin, unsigned end, bool value);
+
+    private:
+      std::vector<uint64_t> words_; //!< One bit per object, set if the object is marked for destruction
+  };
+
+  template <>
+  struct ComponentArrayStorage<Destructible>
+  {
+    using Type = DestructibleArray; //!< Array type used for the component
+  };
 
   void DestructibleReflect();
 }
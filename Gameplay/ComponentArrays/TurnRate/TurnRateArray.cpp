@@ -0,0 +1,31 @@
+/* ======================================================================== */
+/*!
+ * \file            TurnRateArray.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The Turn Rate component keeps track of how fast an object's direction of
+   travel turns. The movement system applies it to the object's velocity
+   in the same pass that moves the object.
+ */
+ /* ======================================================================== */
+
+#include "TurnRateArray.hpp"
+
+namespace Barrage
+{
+  TurnRate::TurnRate() :
+    w_(0.0f)
+  {
+  }
+
+  void TurnRate::Reflect()
+  {
+    rttr::registration::class_<TurnRate>("TurnRate")
+      .constructor<>() (rttr::policy::ctor::as_object)
+      .property("w", &TurnRate::w_)
+      ;
+  }
+}
\ No newline at end of file
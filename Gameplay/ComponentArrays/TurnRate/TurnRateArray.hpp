@@ -0,0 +1,40 @@
+/* ======================================================================== */
+/*!
+ * \file            TurnRateArray.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The Turn Rate component keeps track of how fast an object's direction of
+   travel turns. The movement system applies it to the object's velocity
+   in the same pass that moves the object.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef TurnRateArray_BARRAGE_H
+#define TurnRateArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Components/ComponentArray.hpp"
+#include "Utilities/Utilities.hpp"
+
+namespace Barrage
+{
+  //!< Rate an object's direction of travel turns
+  struct TurnRate
+  {
+    Radian w_; //!< Counterclockwise change in direction per tick, in radians
+
+    TurnRate();
+
+    static void Reflect();
+  };
+
+  typedef Barrage::ComponentArrayT<TurnRate> TurnRateArray;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // TurnRateArray_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -6,34 +6,40 @@
  * \par             david.n.cruse\@gmail.com
 
  * \brief
-
+   The Velocity component keeps track of the speed and direction of a game
+   object, plus kernels that update runs of velocities in bulk.
  */
  /* ======================================================================== */
 
 #include "VelocityArray.hpp"
+#include "Math/Batch/BatchMath.hpp"
 #include "glm/glm.hpp"
 
 namespace Barrage
 {
   Velocity::Velocity() : 
-    angle_(Degree(270.0f)),
-    speed_(0.0f),
     vx_(0.0f), 
-    vy_(0.0f) 
+    vy_(0.0f),
+    speed_(0.0f),
+    dirX_(0.0f),
+    dirY_(-1.0f)
   {
   }
 
   Velocity::Velocity(float angle, float speed) :
-    angle_(angle),
+    vx_(0.0f),
+    vy_(0.0f),
     speed_(speed),
-    vx_(speed * glm::cos(angle)),
-    vy_(speed * glm::sin(angle))
+    dirX_(1.0f),
+    dirY_(0.0f)
   {
+    SinCos(angle, dirY_, dirX_);
+    UpdateCartesianValues();
   }
 
   Radian Velocity::GetAngle() const
   {
-    return angle_;
+    return WrapAngle(Atan2(dirY_, dirX_));
   }
 
   float Velocity::GetSpeed() const
@@ -41,6 +47,16 @@ namespace Barrage
     return speed_;
   }
 
+  float Velocity::GetCosAngle() const
+  {
+    return dirX_;
+  }
+
+  float Velocity::GetSinAngle() const
+  {
+    return dirY_;
+  }
+
   float Velocity::GetVx() const
   {
     return vx_;
@@ -53,7 +69,7 @@ namespace Barrage
 
   void Velocity::SetAngle(Radian angle)
   {
-    angle_.value_ = ClampWrapped(angle.value_, 0.0f, 2.0f * BARRAGE_PI);
+    SinCos(angle.value_, dirY_, dirX_);
 
     UpdateCartesianValues();
   }
@@ -90,7 +106,20 @@ namespace Barrage
 
   void Velocity::Rotate(float angle)
   {
-    SetAngle(angle + angle_.value_);
+    float cos_angle, sin_angle;
+
+    SinCos(angle, sin_angle, cos_angle);
+
+    float dir_x = dirX_ * cos_angle - dirY_ * sin_angle;
+    float dir_y = dirX_ * sin_angle + dirY_ * cos_angle;
+
+    // one Newton step back to unit length so repeated rotations don't drift
+    float correction = 1.5f - 0.5f * (dir_x * dir_x + dir_y * dir_y);
+
+    dirX_ = dir_x * correction;
+    dirY_ = dir_y * correction;
+
+    UpdateCartesianValues();
   }
 
   void Velocity::AddSpeed(float speed)
@@ -105,20 +134,44 @@ namespace Barrage
 
   void Velocity::UpdateCartesianValues()
   {
-    vx_ = speed_ * glm::cos(angle_.value_);
-    vy_ = speed_ * glm::sin(angle_.value_);
+    vx_ = speed_ * dirX_;
+    vy_ = speed_ * dirY_;
   }
 
   void Velocity::UpdatePolarValues()
   {
-    speed_ = glm::length(glm::vec2(vx_, vy_));
+    speed_ = Length(vx_, vy_);
 
+    // a velocity too small to have a direction keeps its old one
     if (glm::abs(vx_) >= MINIMUM_SPEED_THRESHOLD || glm::abs(vy_) >= MINIMUM_SPEED_THRESHOLD)
     {
-      angle_ = glm::atan(vy_, vx_);
+      dirX_ = vx_ / speed_;
+      dirY_ = vy_ / speed_;
     }
   }
 
+  void ComponentFields<Velocity>::Write(const Velocity& value, float* const* fields, unsigned index)
+  {
+    fields[VX][index] = value.vx_;
+    fields[VY][index] = value.vy_;
+    fields[SPEED][index] = value.speed_;
+    fields[DIR_X][index] = value.dirX_;
+    fields[DIR_Y][index] = value.dirY_;
+  }
+
+  Velocity ComponentFields<Velocity>::Read(const float* const* fields, unsigned index)
+  {
+    Velocity value;
+
+    value.vx_ = fields[VX][index];
+    value.vy_ = fields[VY][index];
+    value.speed_ = fields[SPEED][index];
+    value.dirX_ = fields[DIR_X][index];
+    value.dirY_ = fields[DIR_Y][index];
+
+    return value;
+  }
+
   void Velocity::Reflect()
   {
     rttr::registration::class_<Velocity>("Velocity")
@@ -129,4 +182,134 @@ namespace Barrage
       .property("vy", &Velocity::GetVy, &Velocity::SetVy)
       ;
   }
+
+  void RotateVelocities(VelocityArray& velocities, unsigned begin, unsigned count, float cosAngle, float sinAngle)
+  {
+    float* vx = velocities.GetField(VelocityFields::VX) + begin;
+    float* vy = velocities.GetField(VelocityFields::VY) + begin;
+    const float* speed = velocities.GetField(VelocityFields::SPEED) + begin;
+    float* dir_x = velocities.GetField(VelocityFields::DIR_X) + begin;
+    float* dir_y = velocities.GetField(VelocityFields::DIR_Y) + begin;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      float x = dir_x[i] * cosAngle - dir_y[i] * sinAngle;
+      float y = dir_x[i] * sinAngle + dir_y[i] * cosAngle;
+      float correction = 1.5f - 0.5f * (x * x + y * y);
+
+      dir_x[i] = x * correction;
+      dir_y[i] = y * correction;
+      vx[i] = speed[i] * dir_x[i];
+      vy[i] = speed[i] * dir_y[i];
+    }
+  }
+
+  void RotateVelocities(VelocityArray& velocities, unsigned begin, unsigned count, float angle)
+  {
+    float cos_angle, sin_angle;
+
+    SinCos(angle, sin_angle, cos_angle);
+
+    RotateVelocities(velocities, begin, count, cos_angle, sin_angle);
+  }
+
+  void RotateVelocities(VelocityArray& velocities, unsigned begin, unsigned count, const float* cosAngles, const float* sinAngles)
+  {
+    float* vx = velocities.GetField(VelocityFields::VX) + begin;
+    float* vy = velocities.GetField(VelocityFields::VY) + begin;
+    const float* speed = velocities.GetField(VelocityFields::SPEED) + begin;
+    float* dir_x = velocities.GetField(VelocityFields::DIR_X) + begin;
+    float* dir_y = velocities.GetField(VelocityFields::DIR_Y) + begin;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      float x = dir_x[i] * cosAngles[i] - dir_y[i] * sinAngles[i];
+      float y = dir_x[i] * sinAngles[i] + dir_y[i] * cosAngles[i];
+      float correction = 1.5f - 0.5f * (x * x + y * y);
+
+      dir_x[i] = x * correction;
+      dir_y[i] = y * correction;
+      vx[i] = speed[i] * dir_x[i];
+      vy[i] = speed[i] * dir_y[i];
+    }
+  }
+
+  void SetVelocityDirections(VelocityArray& velocities, unsigned begin, unsigned count, float cosAngle, float sinAngle)
+  {
+    float* vx = velocities.GetField(VelocityFields::VX) + begin;
+    float* vy = velocities.GetField(VelocityFields::VY) + begin;
+    const float* speed = velocities.GetField(VelocityFields::SPEED) + begin;
+    float* dir_x = velocities.GetField(VelocityFields::DIR_X) + begin;
+    float* dir_y = velocities.GetField(VelocityFields::DIR_Y) + begin;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      dir_x[i] = cosAngle;
+      dir_y[i] = sinAngle;
+      vx[i] = speed[i] * cosAngle;
+      vy[i] = speed[i] * sinAngle;
+    }
+  }
+
+  void SetVelocityAngles(VelocityArray& velocities, unsigned begin, unsigned count, float angle)
+  {
+    float cos_angle, sin_angle;
+
+    SinCos(angle, sin_angle, cos_angle);
+
+    SetVelocityDirections(velocities, begin, count, cos_angle, sin_angle);
+  }
+
+  void SetVelocityAngles(VelocityArray& velocities, unsigned begin, unsigned count, const float* angles)
+  {
+    float* vx = velocities.GetField(VelocityFields::VX) + begin;
+    float* vy = velocities.GetField(VelocityFields::VY) + begin;
+    const float* speed = velocities.GetField(VelocityFields::SPEED) + begin;
+    float* dir_x = velocities.GetField(VelocityFields::DIR_X) + begin;
+    float* dir_y = velocities.GetField(VelocityFields::DIR_Y) + begin;
+
+    SinCos(angles, dir_y, dir_x, count);
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      vx[i] = speed[i] * dir_x[i];
+      vy[i] = speed[i] * dir_y[i];
+    }
+  }
+
+  void SetVelocitySpeeds(VelocityArray& velocities, unsigned begin, unsigned count, float speed)
+  {
+    float* vx = velocities.GetField(VelocityFields::VX) + begin;
+    float* vy = velocities.GetField(VelocityFields::VY) + begin;
+    float* speeds = velocities.GetField(VelocityFields::SPEED) + begin;
+    const float* dir_x = velocities.GetField(VelocityFields::DIR_X) + begin;
+    const float* dir_y = velocities.GetField(VelocityFields::DIR_Y) + begin;
+
+    speed = speed < 0.0f ? 0.0f : speed;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      speeds[i] = speed;
+      vx[i] = speed * dir_x[i];
+      vy[i] = speed * dir_y[i];
+    }
+  }
+
+  void AddVelocitySpeeds(VelocityArray& velocities, unsigned begin, unsigned count, float speed)
+  {
+    float* vx = velocities.GetField(VelocityFields::VX) + begin;
+    float* vy = velocities.GetField(VelocityFields::VY) + begin;
+    float* speeds = velocities.GetField(VelocityFields::SPEED) + begin;
+    const float* dir_x = velocities.GetField(VelocityFields::DIR_X) + begin;
+    const float* dir_y = velocities.GetField(VelocityFields::DIR_Y) + begin;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      float new_speed = speeds[i] + speed;
+
+      speeds[i] = new_speed < 0.0f ? 0.0f : new_speed;
+      vx[i] = speeds[i] * dir_x[i];
+      vy[i] = speeds[i] * dir_y[i];
+    }
+  }
 }
\ No newline at end of file
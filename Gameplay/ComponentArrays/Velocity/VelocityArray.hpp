@@ -7,7 +7,14 @@
 
  * \brief
    The Velocity component keeps track of the speed and direction of a game
-   object.
+   object. Velocity arrays are split into per-field streams so movement
+   only has to read the vx/vy streams.
+
+   Velocities are stored as vx/vy plus the speed and the direction's
+   cosine and sine, so setting a speed or rotating by a known angle never
+   needs trig. The angle itself is only worked out (with atan2) when
+   something asks for it. Runs of velocities can be rotated, aimed, and
+   sped up in bulk with the functions at the bottom of this file.
  */
 /* ======================================================================== */
 
@@ -16,7 +23,7 @@
 #define VelocityArray_BARRAGE_H
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "Objects/Components/ComponentArray.hpp"
+#include "Objects/Components/SplitComponentArray.hpp"
 #include "Utilities/Utilities.hpp"
 
 namespace Barrage
@@ -32,6 +39,10 @@ namespace Barrage
 
     float GetSpeed() const;
 
+    float GetCosAngle() const;
+
+    float GetSinAngle() const;
+
     float GetVx() const;
 
     float GetVy() const;
@@ -60,15 +71,223 @@ namespace Barrage
       void UpdatePolarValues();
 
     private:
-      Radian angle_; //!< angle from x axis (counterclockwise is positive)
-      float speed_;  //!< total speed in world units per tick
       float vx_;     //!< x speed in world units per tick
       float vy_;     //!< y speed in world units per tick
+      float speed_;  //!< total speed in world units per tick
+      float dirX_;   //!< cosine of the angle from the x axis (kept when the speed is zero)
+      float dirY_;   //!< sine of the angle from the x axis (kept when the speed is zero)
 
       static constexpr float MINIMUM_SPEED_THRESHOLD = 0.000001f;
+
+      friend struct ComponentFields<Velocity>;
+  };
+
+  //!< Splits velocities into vx, vy, speed, and direction streams (the angle is only computed when asked for)
+  template <>
+  struct ComponentFields<Velocity>
+  {
+    enum Field : unsigned
+    {
+      VX,
+      VY,
+      SPEED,
+      DIR_X,
+      DIR_Y,
+      NUM_FIELDS
+    };
+
+    static void Write(const Velocity& value, float* const* fields, unsigned index);
+
+    static Velocity Read(const float* const* fields, unsigned index);
+  };
+
+  typedef ComponentFields<Velocity> VelocityFields;
+
+  template <>
+  struct ComponentArrayStorage<Velocity>
+  {
+    using Type = SplitComponentArrayT<Velocity>; //!< Array type used for the component
   };
 
-  typedef Barrage::ComponentArrayT<Velocity> VelocityArray;
+  typedef Barrage::SplitComponentArrayT<Velocity> VelocityArray;
+
+  /**************************************************************/
+  /*!
+    \brief
+      Rotates a run of velocities by the same angle, given as its
+      cosine and sine. No trig is done per object.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to rotate.
+
+    \param count
+      Number of velocities to rotate.
+
+    \param cosAngle
+      Cosine of the angle to rotate by (counterclockwise).
+
+    \param sinAngle
+      Sine of the angle to rotate by.
+  */
+  /**************************************************************/
+  void RotateVelocities(VelocityArray& velocities, unsigned begin, unsigned count, float cosAngle, float sinAngle);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Rotates a run of velocities by the same angle.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to rotate.
+
+    \param count
+      Number of velocities to rotate.
+
+    \param angle
+      The angle to rotate by, in radians (counterclockwise).
+  */
+  /**************************************************************/
+  void RotateVelocities(VelocityArray& velocities, unsigned begin, unsigned count, float angle);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Rotates each velocity in a run by its own angle, given as
+      the cosine and sine of the angle.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to rotate.
+
+    \param count
+      Number of velocities to rotate.
+
+    \param cosAngles
+      Cosine of the angle to rotate each velocity by
+      (counterclockwise).
+
+    \param sinAngles
+      Sine of the angle to rotate each velocity by.
+  */
+  /**************************************************************/
+  void RotateVelocities(VelocityArray& velocities, unsigned begin, unsigned count, const float* cosAngles, const float* sinAngles);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Points a run of velocities in the same direction, given as
+      the cosine and sine of its angle. Speeds are kept.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to set.
+
+    \param count
+      Number of velocities to set.
+
+    \param cosAngle
+      Cosine of the new angle.
+
+    \param sinAngle
+      Sine of the new angle.
+  */
+  /**************************************************************/
+  void SetVelocityDirections(VelocityArray& velocities, unsigned begin, unsigned count, float cosAngle, float sinAngle);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Points a run of velocities in the same direction. Speeds are
+      kept.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to set.
+
+    \param count
+      Number of velocities to set.
+
+    \param angle
+      The new angle, in radians from the x axis.
+  */
+  /**************************************************************/
+  void SetVelocityAngles(VelocityArray& velocities, unsigned begin, unsigned count, float angle);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Points each velocity in a run in its own direction, using
+      the batched SinCos() in one pass. Speeds are kept.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to set.
+
+    \param count
+      Number of velocities to set.
+
+    \param angles
+      The new angle of each velocity, in radians from the x axis.
+  */
+  /**************************************************************/
+  void SetVelocityAngles(VelocityArray& velocities, unsigned begin, unsigned count, const float* angles);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Sets the speed of a run of velocities, keeping their
+      directions. Negative speeds are clamped to zero.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to set.
+
+    \param count
+      Number of velocities to set.
+
+    \param speed
+      The new speed.
+  */
+  /**************************************************************/
+  void SetVelocitySpeeds(VelocityArray& velocities, unsigned begin, unsigned count, float speed);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Adds to the speed of a run of velocities, keeping their
+      directions. Speeds that would go negative are clamped to
+      zero.
+
+    \param velocities
+      The velocity array.
+
+    \param begin
+      Index of the first velocity to change.
+
+    \param count
+      Number of velocities to change.
+
+    \param speed
+      The speed to add.
+  */
+  /**************************************************************/
+  void AddVelocitySpeeds(VelocityArray& velocities, unsigned begin, unsigned count, float speed);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -53,22 +53,23 @@ namespace Barrage
   }
 
   template <>
-  void ComponentT<Animation>::SetCapacity(unsigned capacity)
+  void ComponentT<Animation>::SetCapacity(unsigned capacity, unsigned numObjects)
   {
-    data_.animationStates_.SetCapacity(capacity);
+    data_.animationStates_.SetCapacity(capacity, numObjects);
+    data_.animationStates_.Resize(capacity);
 
-    for (unsigned i = 0; i < capacity; ++i)
+    for (unsigned i = numObjects; i < capacity; ++i)
     {
       data_.animationStates_.Data(i) = AnimationState();
     }
   }
 
   template <>
-  void ComponentT<Animation>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void ComponentT<Animation>::HandleDestructions(const DestructionPlan& plan)
   {
-    unsigned numAliveObjects = data_.animationStates_.HandleDestructions(destructionArray, writeIndex, endIndex);
+    data_.animationStates_.HandleDestructions(plan);
 
-    for (unsigned i = numAliveObjects; i < endIndex; ++i)
+    for (unsigned i = plan.numAliveObjects_; i < plan.endIndex_; ++i)
     {
       data_.animationStates_.Data(i) = AnimationState();;
     }
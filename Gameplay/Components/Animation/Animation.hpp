@@ -59,10 +59,10 @@ namespace Barrage
   typedef ComponentT<Animation> AnimationComponent;
 
   template <>
-  void ComponentT<Animation>::SetCapacity(unsigned capacity);
+  void ComponentT<Animation>::SetCapacity(unsigned capacity, unsigned numObjects);
 
   template <>
-  void ComponentT<Animation>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex);
+  void ComponentT<Animation>::HandleDestructions(const DestructionPlan& plan);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
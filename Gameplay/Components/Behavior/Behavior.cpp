@@ -16,14 +16,14 @@
 namespace Barrage
 {
   template <>
-  void ComponentT<BehaviorTree>::SetCapacity(unsigned capacity)
+  void ComponentT<BehaviorTree>::SetCapacity(unsigned capacity, unsigned numObjects)
   {
-    data_.SetCapacity(capacity);
+    data_.SetCapacity(capacity, numObjects);
   }
 
   template <>
-  void ComponentT<BehaviorTree>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void ComponentT<BehaviorTree>::HandleDestructions(const DestructionPlan& plan)
   {
-    data_.HandleDestructions(destructionArray, writeIndex, endIndex);
+    data_.HandleDestructions(plan);
   }
 }
\ No newline at end of file
@@ -24,10 +24,10 @@ namespace Barrage
   typedef Barrage::ComponentT<BehaviorTree> BehaviorTreeComponent;
 
   template <>
-  void ComponentT<BehaviorTree>::SetCapacity(unsigned capacity);
+  void ComponentT<BehaviorTree>::SetCapacity(unsigned capacity, unsigned numObjects);
 
   template <>
-  void ComponentT<BehaviorTree>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex);
+  void ComponentT<BehaviorTree>::HandleDestructions(const DestructionPlan& plan);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
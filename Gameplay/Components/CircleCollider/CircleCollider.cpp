@@ -15,7 +15,8 @@
 namespace Barrage
 {
   CircleCollider::CircleCollider() : 
-    radius_(32.0f) 
+    radius_(32.0f),
+    swept_(false)
   {
   }
 
@@ -24,6 +25,7 @@ namespace Barrage
     rttr::registration::class_<CircleCollider>("CircleCollider")
       .constructor<>() (rttr::policy::ctor::as_object)
       .property("radius", &CircleCollider::radius_)
+      .property("swept", &CircleCollider::swept_)
       ;
   }
 }
\ No newline at end of file
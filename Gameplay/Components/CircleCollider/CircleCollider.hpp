@@ -25,6 +25,7 @@ namespace Barrage
   {
     public:
       float radius_;
+      bool swept_;   //!< If true, objects collide along the path they moved this tick (needs a Velocity array)
 
       CircleCollider();
 
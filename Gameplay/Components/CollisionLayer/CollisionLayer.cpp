@@ -0,0 +1,32 @@
+/* ======================================================================== */
+/*!
+ * \file            CollisionLayer.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Puts a pool's colliders on a collision layer and picks which layers the
+   pool tests its colliders against.
+ */
+ /* ======================================================================== */
+
+#include "CollisionLayer.hpp"
+
+namespace Barrage
+{
+  CollisionLayer::CollisionLayer() : 
+    layer_(0), 
+    mask_(0) 
+  {
+  }
+
+  void CollisionLayer::Reflect()
+  {
+    rttr::registration::class_<CollisionLayer>("CollisionLayer")
+      .constructor<>() (rttr::policy::ctor::as_object)
+      .property("layer", &CollisionLayer::layer_)
+      .property("mask", &CollisionLayer::mask_)
+      ;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/* ======================================================================== */
+/*!
+ * \file            CollisionLayer.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Puts a pool's colliders on a collision layer and picks which layers the
+   pool tests its colliders against.
+ */
+ /* ======================================================================== */
+
+ ////////////////////////////////////////////////////////////////////////////////
+#ifndef CollisionLayer_BARRAGE_H
+#define CollisionLayer_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Components/Component.hpp"
+
+namespace Barrage
+{
+  constexpr unsigned MAX_COLLISION_LAYERS = 32; //!< Number of collision layers (one bit each in a layer mask)
+
+  //! Collision layer and layer mask of a pool
+  class CollisionLayer
+  {
+    public:
+      unsigned layer_; //!< The layer the pool's colliders are on (0 to MAX_COLLISION_LAYERS - 1)
+      unsigned mask_;  //!< Bit n set means the pool tests its colliders against layer n
+
+      CollisionLayer();
+
+      static void Reflect();
+  };
+
+  typedef Barrage::ComponentT<CollisionLayer> CollisionLayerComponent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // CollisionLayer_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -15,7 +15,8 @@
 namespace Barrage
 {
   Movement::Movement() :
-    curve_()
+    curve_(),
+    path_()
   {
   }
 
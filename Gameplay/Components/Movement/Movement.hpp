@@ -16,7 +16,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Objects/Components/Component.hpp"
-#include "Math/Curves/BezierCurve.hpp"
+#include "Math/Curves/ArcLengthTable.hpp"
 
 namespace Barrage
 {
@@ -25,6 +25,7 @@ namespace Barrage
   {
     public:
       BezierCurve curve_;
+      ArcLengthTable path_; //!< curve_ baked by distance when the pool subscribes to the movement system
 
       Movement();
 
@@ -12,8 +12,20 @@
 
 #include "Spawner.hpp"
 
+#include <algorithm>
+
 namespace Barrage
 {
+  namespace
+  {
+    const unsigned DESTROYED_OBJECT = static_cast<unsigned>(-1);
+  }
+
+  bool FiresLater(const ScheduledSpawn& lhs, const ScheduledSpawn& rhs)
+  {
+    return lhs.tick_ != rhs.tick_ ? lhs.tick_ > rhs.tick_ : lhs.object_ > rhs.object_;
+  }
+
   AutomaticSpawn::AutomaticSpawn() :
     spawnType_(),
     ticksPerSpawn_(0),
@@ -31,8 +43,116 @@ namespace Barrage
     currentPattern_(), 
     patterns_(), 
     spawnTypes_(),
-    spawnTimers_()
+    startTicks_(),
+    tick_(0),
+    numScheduledObjects_(0),
+    rescheduleNeeded_(false),
+    scheduledPattern_(),
+    schedules_(),
+    newIndices_()
+  {
+  }
+
+  void Spawner::ScheduleObject(const std::vector<AutomaticSpawn>& automaticSpawns, unsigned object)
+  {
+    unsigned startTick = startTicks_.Data(object);
+    unsigned timer = tick_ - startTick;
+
+    for (unsigned i = 0; i < automaticSpawns.size(); ++i)
+    {
+      const AutomaticSpawn& automaticSpawn = automaticSpawns[i];
+      std::vector<ScheduledSpawn>& schedule = schedules_[i];
+
+      if (timer <= automaticSpawn.delay_)
+      {
+        schedule.emplace_back(startTick + automaticSpawn.delay_, object);
+      }
+      else if (automaticSpawn.ticksPerSpawn_)
+      {
+        unsigned elapsed = timer - automaticSpawn.delay_;
+        unsigned numSpawns = (elapsed + automaticSpawn.ticksPerSpawn_ - 1) / automaticSpawn.ticksPerSpawn_;
+
+        schedule.emplace_back(startTick + automaticSpawn.delay_ + numSpawns * automaticSpawn.ticksPerSpawn_, object);
+      }
+      else
+      {
+        continue;
+      }
+
+      std::push_heap(schedule.begin(), schedule.end(), FiresLater);
+    }
+  }
+
+  void Spawner::HandleDestructions(const DestructionPlan& plan)
   {
+    unsigned numSeenObjects = numScheduledObjects_;
+
+    // objects that arrived since the last schedule update start now, before they get moved
+    for (unsigned i = numSeenObjects; i < plan.endIndex_; ++i)
+    {
+      startTicks_.Data(i) = tick_;
+    }
+
+    startTicks_.HandleDestructions(plan);
+    numScheduledObjects_ = plan.numAliveObjects_;
+
+    auto pattern = patterns_.find(scheduledPattern_);
+
+    // schedules that are about to be rebuilt anyway aren't worth fixing
+    if (rescheduleNeeded_ || scheduledPattern_ != currentPattern_ || pattern == patterns_.end() || schedules_.size() != pattern->second.automaticSpawns_.size())
+    {
+      rescheduleNeeded_ = true;
+      return;
+    }
+
+    // objects below the alive count stay put unless a move overwrites them, and the rest are destroyed unless moved
+    newIndices_.resize(plan.endIndex_);
+
+    for (unsigned i = 0; i < plan.endIndex_; ++i)
+    {
+      newIndices_[i] = i < plan.numAliveObjects_ ? i : DESTROYED_OBJECT;
+    }
+
+    for (auto it = plan.moves_.begin(); it != plan.moves_.end(); ++it)
+    {
+      std::fill_n(newIndices_.begin() + it->recipientIndex_, it->count_, DESTROYED_OBJECT);
+    }
+
+    for (auto it = plan.moves_.begin(); it != plan.moves_.end(); ++it)
+    {
+      for (unsigned i = 0; i < it->count_; ++i)
+      {
+        newIndices_[it->sourceIndex_ + i] = it->recipientIndex_ + i;
+      }
+    }
+
+    // moved objects keep their fire ticks, but the heaps are rebuilt since tick ties are broken by index
+    for (auto it = schedules_.begin(); it != schedules_.end(); ++it)
+    {
+      std::vector<ScheduledSpawn>& schedule = *it;
+      unsigned numKept = 0;
+
+      for (unsigned i = 0; i < schedule.size(); ++i)
+      {
+        unsigned newIndex = newIndices_[schedule[i].object_];
+
+        if (newIndex != DESTROYED_OBJECT)
+        {
+          schedule[numKept++] = ScheduledSpawn(schedule[i].tick_, newIndex);
+        }
+      }
+
+      schedule.erase(schedule.begin() + numKept, schedule.end());
+      std::make_heap(schedule.begin(), schedule.end(), FiresLater);
+    }
+
+    for (unsigned i = numSeenObjects; i < plan.endIndex_; ++i)
+    {
+      if (newIndices_[i] != DESTROYED_OBJECT)
+      {
+        ScheduleObject(pattern->second.automaticSpawns_, newIndices_[i]);
+      }
+    }
   }
 
   void Spawner::Reflect()
@@ -72,38 +192,44 @@ namespace Barrage
   }
 
   template <>
-  void ComponentT<Spawner>::SetCapacity(unsigned capacity)
+  void ComponentT<Spawner>::SetCapacity(unsigned capacity, unsigned numObjects)
   {
-    data_.spawnTimers_.SetCapacity(capacity);
-
-    for (unsigned i = 0; i < capacity; ++i)
-    {
-      data_.spawnTimers_.Data(i) = 0;
-    }
+    // start ticks of new objects are set by the spawn system when it first sees them
+    data_.startTicks_.SetCapacity(capacity, numObjects);
+    data_.startTicks_.Resize(capacity);
     
     for (auto it = data_.spawnTypes_.begin(); it != data_.spawnTypes_.end(); ++it)
     {
       SpawnType& spawnType = it->second;
 
-      spawnType.SetCapacity(capacity);
+      spawnType.SetCapacity(capacity, numObjects);
     }
   }
 
   template <>
-  void ComponentT<Spawner>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex)
+  void ComponentT<Spawner>::HandleDestructions(const DestructionPlan& plan)
   {
-    unsigned numAliveObjects = data_.spawnTimers_.HandleDestructions(destructionArray, writeIndex, endIndex);
-
-    for (unsigned i = numAliveObjects; i < endIndex; ++i)
-    {
-      data_.spawnTimers_.Data(i) = 0;
-    }
+    data_.HandleDestructions(plan);
     
     for (auto it = data_.spawnTypes_.begin(); it != data_.spawnTypes_.end(); ++it)
     {
       SpawnType& spawnType = it->second;
 
-      spawnType.HandleDestructions(destructionArray, writeIndex, endIndex);
+      spawnType.HandleDestructions(plan);
     }
   }
-}
\ No newline at end of file
+
+  template <>
+  void ComponentT<Spawner>::SetRTTRValue(const rttr::variant& value)
+  {
+    if (value.get_type() != rttr::type::get<Spawner>())
+    {
+      return;
+    }
+
+    data_ = value.get_value<Spawner>();
+
+    // an edit can change any spawn's delay or period in place, which the schedules can't see
+    data_.rescheduleNeeded_ = true;
+  }
+}
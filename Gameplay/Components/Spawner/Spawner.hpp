@@ -45,27 +45,94 @@ namespace Barrage
 
   typedef std::map<std::string, SpawnPattern> PatternMap;
 
+  //!< The next tick an object fires an automatic spawn on
+  struct ScheduledSpawn
+  {
+    unsigned tick_;   //!< The spawner tick the object fires on
+    unsigned object_; //!< The index of the object
+
+    inline ScheduledSpawn(unsigned tick, unsigned object) : tick_(tick), object_(object) {}
+  };
+
+  /**************************************************************/
+  /*!
+    \brief
+      Heap order for schedules: the earliest tick on top, and lower
+      object indices first within a tick.
+
+    \param lhs
+      The first scheduled spawn.
+
+    \param rhs
+      The second scheduled spawn.
+
+    \return
+      Returns true if lhs fires after rhs.
+  */
+  /**************************************************************/
+  bool FiresLater(const ScheduledSpawn& lhs, const ScheduledSpawn& rhs);
+
   //! Component that allows objects to spawn other objects
   class Spawner
   {
     public:
-      std::string currentPattern_;            //!< The current pattern being used by the spawner
-      PatternMap patterns_;                   //!< The patterns available to use
-      SpawnTypeMap spawnTypes_;               //!< The spawn types available to use
-      ComponentArrayT<unsigned> spawnTimers_; //!< Per-object spawn timers
+      std::string currentPattern_;                         //!< The current pattern being used by the spawner
+      PatternMap patterns_;                                //!< The patterns available to use
+      SpawnTypeMap spawnTypes_;                            //!< The spawn types available to use
+      ComponentArrayT<unsigned> startTicks_;               //!< Per-object tick the object's spawn timer started on
+
+      unsigned tick_;                                      //!< Ticks since the spawner started (an object's timer is tick_ minus its start tick)
+      unsigned numScheduledObjects_;                       //!< Objects at the front of the pool that have a start tick and are scheduled
+      bool rescheduleNeeded_;                              //!< Set when the patterns are edited, so the schedules must be rebuilt
+      std::string scheduledPattern_;                       //!< The pattern the schedules were built for
+      std::vector<std::vector<ScheduledSpawn>> schedules_; //!< Min-heap of upcoming fires for each automatic spawn in the scheduled pattern
+      std::vector<unsigned> newIndices_;                   //!< Scratch space mapping old object indices to new ones during destructions
 
       Spawner();
 
+      /**************************************************************/
+      /*!
+        \brief
+          Adds an object's next fire on or after the current tick to
+          each schedule, for the spawns that fire again.
+
+        \param automaticSpawns
+          The automatic spawns of the scheduled pattern.
+
+        \param object
+          The index of the object. Its start tick must be set.
+      */
+      /**************************************************************/
+      void ScheduleObject(const std::vector<AutomaticSpawn>& automaticSpawns, unsigned object);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Updates the schedules for objects that are about to be
+          destroyed or moved. Entries of destroyed objects are
+          dropped, moved objects keep their fire ticks under their
+          new indices, and surviving objects the schedules hadn't
+          seen yet are added.
+
+        \param plan
+          The destruction plan about to be applied to the pool.
+      */
+      /**************************************************************/
+      void HandleDestructions(const DestructionPlan& plan);
+
       static void Reflect();
   };
 
   typedef ComponentT<Spawner> SpawnerComponent;
 
   template <>
-  void ComponentT<Spawner>::SetCapacity(unsigned capacity);
+  void ComponentT<Spawner>::SetCapacity(unsigned capacity, unsigned numObjects);
+
+  template <>
+  void ComponentT<Spawner>::HandleDestructions(const DestructionPlan& plan);
 
   template <>
-  void ComponentT<Spawner>::HandleDestructions(const Destructible* destructionArray, unsigned writeIndex, unsigned endIndex);
+  void ComponentT<Spawner>::SetRTTRValue(const rttr::variant& value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
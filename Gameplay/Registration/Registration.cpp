@@ -30,25 +30,32 @@
 #include "Behavior/Parallel/Selector/BehaviorParallelSelector.hpp"
 #include "Behavior/Parallel/Sequence/BehaviorParallelSequence.hpp"
 
+#include "ComponentArrays/Acceleration/AccelerationArray.hpp"
 #include "ComponentArrays/AngularSpeed/AngularSpeedArray.hpp"
 #include "ComponentArrays/ColorTint/ColorTintArray.hpp"
+#include "ComponentArrays/CurveProgress/CurveProgressArray.hpp"
 #include "ComponentArrays/Destructible/DestructibleArray.hpp"
 #include "ComponentArrays/Lifetime/LifetimeArray.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Rotation/RotationArray.hpp"
 #include "ComponentArrays/Scale/ScaleArray.hpp"
 #include "ComponentArrays/TextureUV/TextureUVArray.hpp"
+#include "ComponentArrays/TurnRate/TurnRateArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
 
 #include "Components/Animation/Animation.hpp"
 #include "Components/Behavior/Behavior.hpp"
 #include "Components/BoundaryBox/BoundaryBox.hpp"
 #include "Components/CircleCollider/CircleCollider.hpp"
+#include "Components/CollisionLayer/CollisionLayer.hpp"
 #include "Components/Movement/Movement.hpp"
 #include "Components/Player/Player.hpp"
 #include "Components/Spawner/Spawner.hpp"
 #include "Components/Sprite/Sprite.hpp"
 
+#include "SpawnRules/Acceleration/Random/SpawnRandomAcceleration.hpp"
+#include "SpawnRules/Acceleration/Set/SpawnSetAcceleration.hpp"
+
 #include "SpawnRules/Color/Set/SpawnSetColor.hpp"
 
 #include "SpawnRules/Count/Iterate/SpawnIterateCount.hpp"
@@ -85,6 +92,9 @@
 #include "SpawnRules/Speed/Random/SpawnRandomSpeed.hpp"
 #include "SpawnRules/Speed/Set/SpawnSetSpeed.hpp"
 
+#include "SpawnRules/TurnRate/Random/SpawnRandomTurnRate.hpp"
+#include "SpawnRules/TurnRate/Set/SpawnSetTurnRate.hpp"
+
 #include "Systems/Behavior/BehaviorSystem.hpp"
 #include "Systems/Collision/CollisionSystem.hpp"
 #include "Systems/Destruction/DestructionSystem.hpp"
@@ -114,25 +124,32 @@ namespace Barrage
     RegisterBehaviorNode<Behavior::ParallelSelector>("ParallelSelector");
     RegisterBehaviorNode<Behavior::ParallelSequence>("ParallelSequence");
 
+    RegisterComponentArray<Acceleration>("Acceleration");
     RegisterComponentArray<AngularSpeed>("AngularSpeed");
     RegisterComponentArray<ColorTint>("ColorTint");
+    RegisterComponentArray<CurveProgress>("CurveProgress");
     RegisterComponentArray<Destructible>("Destructible");
     RegisterComponentArray<Lifetime>("Lifetime");
     RegisterComponentArray<Position>("Position");
     RegisterComponentArray<Rotation>("Rotation");
     RegisterComponentArray<Scale>("Scale");
     RegisterComponentArray<TextureUV>("TextureUV");
+    RegisterComponentArray<TurnRate>("TurnRate");
     RegisterComponentArray<Velocity>("Velocity");
 
     RegisterComponent<Animation>("Animation");
     RegisterComponent<BehaviorTree>("BehaviorTree");
     RegisterComponent<BoundaryBox>("BoundaryBox");
     RegisterComponent<CircleCollider>("CircleCollider");
+    RegisterComponent<CollisionLayer>("CollisionLayer");
     RegisterComponent<Movement>("Movement");
     RegisterComponent<Player>("Player");
     RegisterComponent<Sprite>("Sprite");
     RegisterComponent<Spawner>("Spawner");
     
+    RegisterSpawnRule<Spawn::RandomAcceleration>("RandomAcceleration");
+    RegisterSpawnRule<Spawn::SetAcceleration>("SetAcceleration");
+
     RegisterSpawnRule<Spawn::SetColor>("SetColor");
 
     RegisterSpawnRule<Spawn::IterateCount>("IterateCount");
@@ -169,6 +186,9 @@ namespace Barrage
     RegisterSpawnRule<Spawn::RandomSpeed>("RandomSpeed");
     RegisterSpawnRule<Spawn::SetSpeed>("SetSpeed");
 
+    RegisterSpawnRule<Spawn::RandomTurnRate>("RandomTurnRate");
+    RegisterSpawnRule<Spawn::SetTurnRate>("SetTurnRate");
+
     RegisterSystem<BehaviorSystem>("BehaviorSystem");
     RegisterSystem<CollisionSystem>("CollisionSystem");
     RegisterSystem<DestructionSystem>("DestructionSystem");
@@ -200,19 +220,23 @@ namespace Barrage
     
     Behavior::Repeat::Reflect();
 
+    Acceleration::Reflect();
     AngularSpeed::Reflect();
     ColorTintReflect();
+    CurveProgress::Reflect();
     DestructibleReflect();
     Lifetime::Reflect();
     PositionReflect();
     RotationReflect();
     ScaleReflect();
     TextureUVReflect();
+    TurnRate::Reflect();
     Velocity::Reflect();
 
     Animation::Reflect();
     BoundaryBox::Reflect();
     CircleCollider::Reflect();
+    CollisionLayer::Reflect();
     Movement::Reflect();
     Player::Reflect();
     Spawner::Reflect();
@@ -220,6 +244,9 @@ namespace Barrage
 
     Spawn::SetColor::Reflect();
 
+    Spawn::RandomAcceleration::Reflect();
+    Spawn::SetAcceleration::Reflect();
+
     Spawn::IterateCount::Reflect();
 
     Spawn::AdjustDirection::Reflect();
@@ -244,6 +271,9 @@ namespace Barrage
     Spawn::IterateSpeed::Reflect();
     Spawn::RandomSpeed::Reflect();
     Spawn::SetSpeed::Reflect();
+
+    Spawn::RandomTurnRate::Reflect();
+    Spawn::SetTurnRate::Reflect();
   }
 
   void ObjectManager::Draw()
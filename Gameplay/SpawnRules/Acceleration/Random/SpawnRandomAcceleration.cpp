@@ -0,0 +1,68 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRandomAcceleration.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives each spawned group a random acceleration between the minimum
+   and maximum.
+
+   Requirements:
+   - Acceleration (destination)
+ */
+ /* ======================================================================== */
+
+#include <stdafx.h>
+#include "SpawnRandomAcceleration.hpp"
+#include "Objects/Pools/Pool.hpp"
+#include "Spaces/Space.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    RandomAcceleration::RandomAcceleration() : SpawnRuleT<RandomAccelerationData>("RandomAcceleration") {}
+
+    std::shared_ptr<SpawnRule> RandomAcceleration::Clone() const
+    {
+      return std::make_shared<RandomAcceleration>(*this);
+    }
+
+    void RandomAcceleration::ExecuteBatch(SpawnRuleBatchInfo& info)
+    {
+      AccelerationArray& dest_accelerations = info.destinationPool_.GetComponentArray<Acceleration>();
+
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+      {
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        ApplyRandomAccelerations(dest_accelerations, info.GetRandom(*it), group_info, start_index, data_.minAcceleration_, data_.maxAcceleration_);
+        start_index += CalculateDestinationCount(group_info);
+      }
+    }
+
+    void RandomAcceleration::SetRTTRValue(const rttr::variant& value)
+    {
+      SpawnRuleT<RandomAccelerationData>::SetRTTRValue(value);
+
+      if (data_.maxAcceleration_ < data_.minAcceleration_)
+      {
+        data_.maxAcceleration_ = data_.minAcceleration_;
+      }
+    }
+
+    void RandomAcceleration::Reflect()
+    {
+      rttr::registration::class_<Spawn::RandomAccelerationData>("RandomAccelerationData")
+        .constructor<>() (rttr::policy::ctor::as_object)
+        .property("minAcceleration", &Spawn::RandomAccelerationData::minAcceleration_)
+        .property("maxAcceleration", &Spawn::RandomAccelerationData::maxAcceleration_)
+        ;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRandomAcceleration.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives each spawned group a random acceleration between the minimum
+   and maximum.
+
+   Requirements:
+   - Acceleration (destination)
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SpawnRandomAcceleration_BARRAGE_H
+#define SpawnRandomAcceleration_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Spawning/SpawnRule.hpp"
+#include "ComponentArrays/Acceleration/AccelerationArray.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    struct RandomAccelerationData
+    {
+      float minAcceleration_;
+      float maxAcceleration_;
+
+      inline RandomAccelerationData() : minAcceleration_(0.0f), maxAcceleration_(0.0f) {};
+    };
+    
+    class RandomAcceleration : public SpawnRuleT<RandomAccelerationData>
+    {
+      public:
+        RandomAcceleration();
+
+        std::shared_ptr<SpawnRule> Clone() const override;
+
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
+
+        void SetRTTRValue(const rttr::variant& value) override;
+
+        static void Reflect();
+    };
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SpawnRandomAcceleration_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
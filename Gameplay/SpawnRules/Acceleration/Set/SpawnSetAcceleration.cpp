@@ -0,0 +1,69 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnSetAcceleration.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives spawned objects an acceleration. Each group gets the base
+   acceleration plus delta times the group's index.
+
+   Requirements:
+   - Acceleration (destination)
+ */
+ /* ======================================================================== */
+
+#include <stdafx.h>
+#include "SpawnSetAcceleration.hpp"
+#include "Objects/Pools/Pool.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    SetAcceleration::SetAcceleration() : SpawnRuleT<SetAccelerationData>("SetAcceleration") {}
+
+    std::shared_ptr<SpawnRule> SetAcceleration::Clone() const
+    {
+      return std::make_shared<SetAcceleration>(*this);
+    }
+
+    void SetAcceleration::ExecuteBatch(SpawnRuleBatchInfo& info)
+    {
+      AccelerationArray& dest_accelerations = info.destinationPool_.GetComponentArray<Acceleration>();
+
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+      {
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        for (unsigned layerCopy = 0; layerCopy < group_info.numLayerCopies_; ++layerCopy)
+        {
+          for (unsigned group = 0; group < group_info.numGroups_; ++group)
+          {
+            float acceleration = data_.baseAcceleration_ + group * data_.delta_;
+            unsigned group_index = CalculateDestinationIndex(group_info, start_index, 0, group, layerCopy);
+
+            for (unsigned object = 0; object < group_info.numObjectsPerGroup_; ++object)
+            {
+              dest_accelerations.Data(group_index + object).a_ = acceleration;
+            }
+          }
+        }
+
+        start_index += CalculateDestinationCount(group_info);
+      }
+    }
+
+    void SetAcceleration::Reflect()
+    {
+      rttr::registration::class_<Spawn::SetAccelerationData>("SetAccelerationData")
+        .constructor<>() (rttr::policy::ctor::as_object)
+        .property("baseAcceleration", &Spawn::SetAccelerationData::baseAcceleration_)
+        .property("delta", &Spawn::SetAccelerationData::delta_)
+        ;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnSetAcceleration.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives spawned objects an acceleration. Each group gets the base
+   acceleration plus delta times the group's index.
+
+   Requirements:
+   - Acceleration (destination)
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SpawnSetAcceleration_BARRAGE_H
+#define SpawnSetAcceleration_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Spawning/SpawnRule.hpp"
+#include "ComponentArrays/Acceleration/AccelerationArray.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    struct SetAccelerationData
+    {
+      float baseAcceleration_;
+      float delta_;
+
+      inline SetAccelerationData() : baseAcceleration_(0.0f), delta_(0.0f) {};
+    };
+    
+    class SetAcceleration : public SpawnRuleT<SetAccelerationData>
+    {
+      public:
+        SetAcceleration();
+
+        std::shared_ptr<SpawnRule> Clone() const override;
+
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
+
+        static void Reflect();
+    };
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SpawnSetAcceleration_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "SpawnSetColor.hpp"
 #include "Objects/Pools/Pool.hpp"
 
+#include <algorithm>
+
 namespace Barrage
 {
   namespace Spawn
@@ -28,23 +30,11 @@ namespace Barrage
       return std::make_shared<SetColor>(*this);
     }
 
-    void SetColor::Execute(SpawnRuleInfo& info)
+    void SetColor::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      ColorTintArray& dest_colors = info.destinationPool_.GetComponentArray<ColorTint>("ColorTint");
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-      {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            ColorTint& dest_color = dest_colors.Data(dest_index);
-
-            dest_color = data_.color_;
-          }
-        }
-      }
+      ColorTint* dest_colors = info.destinationPool_.GetComponentArray<ColorTint>().GetRaw() + info.startIndex_;
+
+      std::fill(dest_colors, dest_colors + CalculateBatchCount(info), data_.color_);
     }
 
     void SetColor::Reflect()
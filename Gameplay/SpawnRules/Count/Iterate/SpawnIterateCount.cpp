@@ -29,13 +29,17 @@ namespace Barrage
       return std::make_shared<IterateCount>(*this);
     }
 
-    void IterateCount::Execute(SpawnRuleInfo& info)
+    void IterateCount::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      long long new_count = static_cast<long long>(info.groupInfo_.numGroups_) + data_.countStep_;
-      
-      if (new_count >= static_cast<long long>(data_.min_) && new_count <= static_cast<long long>(data_.max_))
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        info.groupInfo_.numGroups_ = static_cast<unsigned>(new_count);
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+        long long new_count = static_cast<long long>(group_info.numGroups_) + data_.countStep_;
+
+        if (new_count >= static_cast<long long>(data_.min_) && new_count <= static_cast<long long>(data_.max_))
+        {
+          group_info.numGroups_ = static_cast<unsigned>(new_count);
+        }
       }
     }
 
@@ -18,6 +18,7 @@
 #include "SpawnIterateDirection.hpp"
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
+#include "Math/Batch/BatchMath.hpp"
 #include "Utilities/Utilities.hpp"
 
 namespace Barrage
@@ -31,27 +32,21 @@ namespace Barrage
       return std::make_shared<IterateDirection>(*this);
     }
 
-    void IterateDirection::Execute(SpawnRuleInfo& info)
+    void IterateDirection::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      float& angle = dataArray_.Data(info.sourceIndex_).angle_.value_;
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
+      unsigned start_index = info.startIndex_;
 
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
+        float& angle = dataArray_.Data(*it).angle_.value_;
+        unsigned count = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
 
-            dest_velocity.Rotate(angle);
-          }
-        }
-      }
+        RotateVelocities(dest_velocities, start_index, count, angle);
 
-      angle = ClampWrapped(angle + data_.angleStep_.value_, 0.0f, 2.0f * BARRAGE_PI);
+        angle = WrapAngle(angle + data_.angleStep_.value_);
+        start_index += count;
+      }
     }
 
     void IterateDirection::Reflect()
@@ -31,25 +31,20 @@ namespace Barrage
       return std::make_shared<MatchSpawnerDirection>(*this);
     }
 
-    void MatchSpawnerDirection::Execute(SpawnRuleInfo& info)
+    void MatchSpawnerDirection::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Velocity& sourceVelocity = info.sourcePool_.GetComponentArray<Velocity>("Velocity").Data(info.sourceIndex_);
-      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& sourceVelocities = info.sourcePool_.GetComponentArray<Velocity>();
+      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>();
+      unsigned startIndex = info.startIndex_;
 
-      Radian sourceAngle = sourceVelocity.GetAngle();
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& destVelocity = destVelocities.Data(destIndex);
-
-            destVelocity.SetAngle(sourceAngle.value_);
-          }
-        }
+        Velocity sourceVelocity = sourceVelocities.Get(*it);
+        unsigned count = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
+
+        SetVelocityDirections(destVelocities, startIndex, count, sourceVelocity.GetCosAngle(), sourceVelocity.GetSinAngle());
+
+        startIndex += count;
       }
     }
   }
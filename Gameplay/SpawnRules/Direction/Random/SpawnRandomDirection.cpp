@@ -17,10 +17,10 @@
 
 #include <stdafx.h>
 #include "SpawnRandomDirection.hpp"
-#include "Random/Random.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
-#include "Spaces/Space.hpp"
+#include "Objects/Pools/Pool.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
 
 namespace Barrage
 {
@@ -33,25 +33,18 @@ namespace Barrage
       return std::make_shared<RandomDirection>(*this);
     }
 
-    void RandomDirection::Execute(SpawnRuleInfo& info)
+    void RandomDirection::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Random& rng = info.space_.RNG();
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        float angle = rng.RangeFloat(0, 2.0f * BARRAGE_PI);
-
-        for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
-            
-            dest_velocity.SetAngle(angle);
-          }
-        }
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        ApplyRandomDirections(dest_velocities, info.GetRandom(*it), group_info, start_index);
+        start_index += CalculateDestinationCount(group_info);
       }
     }
   }
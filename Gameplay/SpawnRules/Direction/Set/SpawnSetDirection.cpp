@@ -29,23 +29,11 @@ namespace Barrage
       return std::make_shared<SetDirection>(*this);
     }
 
-    void SetDirection::Execute(SpawnRuleInfo& info)
+    void SetDirection::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-      {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
-
-            dest_velocity.SetAngle(data_.angle_);
-          }
-        }
-      }
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
+
+      SetVelocityAngles(dest_velocities, info.startIndex_, CalculateBatchCount(info), data_.angle_.value_);
     }
 
     void SetDirection::Reflect()
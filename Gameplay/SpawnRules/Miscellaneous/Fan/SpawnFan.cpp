@@ -19,6 +19,7 @@
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
+#include "SpawnRules/Miscellaneous/SpawnRotateGroups.hpp"
 
 namespace Barrage
 {
@@ -31,40 +32,41 @@ namespace Barrage
       return std::make_shared<Fan>(*this);
     }
 
-    void Fan::Execute(SpawnRuleInfo& info)
+    void Fan::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      if (info.groupInfo_.numGroups_ == 0)
-      {
-        return;
-      }
-      
-      float totalAngle = (info.groupInfo_.numGroups_ - 1) * data_.spacing_.value_;
-      float startAngle = -(totalAngle / 2.0f);
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      unsigned start_index = info.startIndex_;
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        if (group_info.numGroups_ == 0)
         {
-          float angle = startAngle + group * data_.spacing_.value_;
-          float cos_angle = glm::cos(angle);
-          float sin_angle = glm::sin(angle);
-
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& dest_position = dest_positions.Data(dest_index);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
-
-            dest_position.Rotate(cos_angle, sin_angle);
-            dest_velocity.Rotate(angle);
-          }
+          continue;
         }
+
+        float totalAngle = (group_info.numGroups_ - 1) * data_.spacing_.value_;
+        float startAngle = -(totalAngle / 2.0f);
+
+        // the angles only depend on the group count and spacing, so their trig is looked up instead of redone
+        const RotationTable::Entry& rotations = rotations_.Get(group_info.numGroups_, startAngle, data_.spacing_.value_);
+
+        RotateGroups(dest_positions, dest_velocities, group_info, start_index, rotations.cosines_.data(), rotations.sines_.data());
+
+        start_index += CalculateDestinationCount(group_info);
       }
     }
 
+    void Fan::SetRTTRValue(const rttr::variant& value)
+    {
+      SpawnRuleT<FanData>::SetRTTRValue(value);
+
+      rotations_.Clear();
+    }
+
     void Fan::Reflect()
     {
       rttr::registration::class_<Spawn::FanData>("FanData")
@@ -19,6 +19,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Objects/Spawning/SpawnRule.hpp"
+#include "Math/Batch/RotationTable.hpp"
 #include "Utilities/Utilities.hpp"
 
 namespace Barrage
@@ -39,9 +40,14 @@ namespace Barrage
 
         std::shared_ptr<SpawnRule> Clone() const override;
 
-        void Execute(SpawnRuleInfo& info) override;
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
+
+        void SetRTTRValue(const rttr::variant& value) override;
 
         static void Reflect();
+
+      private:
+        RotationTable rotations_;
     };
   }
 }
@@ -31,25 +31,37 @@ namespace Barrage
       return std::make_shared<Mirror>(*this);
     }
 
-    void Mirror::Execute(SpawnRuleInfo& info)
+    void Mirror::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 1; group < info.groupInfo_.numGroups_; group += 2)
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        for (unsigned layerCopy = 0; layerCopy < group_info.numLayerCopies_; ++layerCopy)
         {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
+          for (unsigned group = 1; group < group_info.numGroups_; group += 2)
           {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& position = dest_positions.Data(dest_index);
-            Velocity& velocity = dest_velocities.Data(dest_index);
+            unsigned group_index = CalculateDestinationIndex(group_info, start_index, 0, group, layerCopy);
+
+            for (unsigned dest_index = group_index; dest_index < group_index + group_info.numObjectsPerGroup_; ++dest_index)
+            {
+              Position& position = dest_positions.Data(dest_index);
+              Velocity velocity = dest_velocities.Get(dest_index);
 
-            position.x_  = -position.x_;
-            velocity.SetVx(-velocity.GetVx());
+              position.x_  = -position.x_;
+              velocity.SetVx(-velocity.GetVx());
+
+              dest_velocities.Set(dest_index, velocity);
+            }
           }
         }
+
+        start_index += CalculateDestinationCount(group_info);
       }
     }
   }
@@ -19,6 +19,7 @@
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
+#include "SpawnRules/Miscellaneous/SpawnRotateGroups.hpp"
 #include "Utilities/Utilities.hpp"
 
 namespace Barrage
@@ -32,36 +33,30 @@ namespace Barrage
       return std::make_shared<Ring>(*this);
     }
 
-    void Ring::Execute(SpawnRuleInfo& info)
+    void Ring::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      if (info.groupInfo_.numGroups_ == 0)
-      {
-        return;
-      }
-      
-      float spacing = (2.0f * BARRAGE_PI) / info.groupInfo_.numGroups_;
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      unsigned start_index = info.startIndex_;
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        if (group_info.numGroups_ == 0)
         {
-          float angle = group * spacing;
-          float cos_angle = glm::cos(angle);
-          float sin_angle = glm::sin(angle);
+          continue;
+        }
 
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& dest_position = dest_positions.Data(dest_index);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
+        float spacing = (2.0f * BARRAGE_PI) / group_info.numGroups_;
 
-            dest_position.Rotate(cos_angle, sin_angle);
-            dest_velocity.Rotate(angle);
-          }
-        }
+        // the angles only depend on the group count, so their trig is looked up instead of redone
+        const RotationTable::Entry& rotations = rotations_.Get(group_info.numGroups_, 0.0f, spacing);
+
+        RotateGroups(dest_positions, dest_velocities, group_info, start_index, rotations.cosines_.data(), rotations.sines_.data());
+
+        start_index += CalculateDestinationCount(group_info);
       }
     }
   }
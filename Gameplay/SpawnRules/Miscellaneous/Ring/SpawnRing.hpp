@@ -19,6 +19,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Objects/Spawning/SpawnRule.hpp"
+#include "Math/Batch/RotationTable.hpp"
 
 namespace Barrage
 {
@@ -31,7 +32,10 @@ namespace Barrage
 
         std::shared_ptr<SpawnRule> Clone() const override;
 
-        void Execute(SpawnRuleInfo& info) override;
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
+
+      private:
+        RotationTable rotations_;
     };
   }
 }
@@ -0,0 +1,54 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRotateGroups.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Rotates each group of a spawner's objects by its own angle. Used by the
+   pattern rules (Ring, Fan) that spread groups around a circle.
+ */
+ /* ======================================================================== */
+
+#include <stdafx.h>
+#include "SpawnRotateGroups.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    void RotateGroups(PositionArray& positions, VelocityArray& velocities, const GroupInfo& groupInfo, unsigned startIndex, const float* cosines, const float* sines)
+    {
+      for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+      {
+        unsigned layerIndex = groupInfo.GetObjectIndex(startIndex, 0, 0, layerCopy);
+
+        if (groupInfo.numObjectsPerGroup_ == 1)
+        {
+          // with one object per group, the layer copy lines up with the angle arrays
+          for (unsigned group = 0; group < groupInfo.numGroups_; ++group)
+          {
+            positions.Data(layerIndex + group).Rotate(cosines[group], sines[group]);
+          }
+
+          RotateVelocities(velocities, layerIndex, groupInfo.numGroups_, cosines, sines);
+        }
+        else
+        {
+          for (unsigned group = 0; group < groupInfo.numGroups_; ++group)
+          {
+            unsigned groupIndex = layerIndex + group * groupInfo.numObjectsPerGroup_;
+
+            for (unsigned object = groupIndex; object < groupIndex + groupInfo.numObjectsPerGroup_; ++object)
+            {
+              positions.Data(object).Rotate(cosines[group], sines[group]);
+            }
+
+            RotateVelocities(velocities, groupIndex, groupInfo.numObjectsPerGroup_, cosines[group], sines[group]);
+          }
+        }
+      }
+    }
+  }
+}
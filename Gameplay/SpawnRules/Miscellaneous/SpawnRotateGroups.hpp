@@ -0,0 +1,59 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRotateGroups.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Rotates each group of a spawner's objects by its own angle. Used by the
+   pattern rules (Ring, Fan) that spread groups around a circle.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SpawnRotateGroups_BARRAGE_H
+#define SpawnRotateGroups_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Spawning/SpawnRule.hpp"
+#include "ComponentArrays/Position/PositionArray.hpp"
+#include "ComponentArrays/Velocity/VelocityArray.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    /**************************************************************/
+    /*!
+      \brief
+        Rotates the positions and velocities of each group of a
+        spawner's objects, in every layer copy, by that group's
+        angle.
+
+      \param positions
+        The destination pool's positions.
+
+      \param velocities
+        The destination pool's velocities.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+
+      \param cosines
+        Cosine of each group's angle (one per group).
+
+      \param sines
+        Sine of each group's angle (one per group).
+    */
+    /**************************************************************/
+    void RotateGroups(PositionArray& positions, VelocityArray& velocities, const GroupInfo& groupInfo, unsigned startIndex, const float* cosines, const float* sines);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SpawnRotateGroups_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
+#include "Math/Batch/BatchMath.hpp"
 
 namespace Barrage
 {
@@ -31,34 +32,27 @@ namespace Barrage
       return std::make_shared<AdjustOrientation>(*this);
     }
 
-    void AdjustOrientation::Execute(SpawnRuleInfo& info)
+    void AdjustOrientation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-      {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& dest_position = dest_positions.Data(dest_index);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
+      unsigned dest_begin = info.startIndex_;
+      unsigned dest_count = CalculateBatchCount(info);
 
-            dest_position.Rotate(data_.cosineAngle_, data_.sinAngle_);
-            dest_velocity.Rotate(data_.angle_.value_);
-          }
-        }
+      for (unsigned i = dest_begin; i < dest_begin + dest_count; ++i)
+      {
+        dest_positions.Data(i).Rotate(data_.cosineAngle_, data_.sinAngle_);
       }
+
+      RotateVelocities(dest_velocities, dest_begin, dest_count, data_.cosineAngle_, data_.sinAngle_);
     }
 
     void AdjustOrientation::SetRTTRValue(const rttr::variant& value)
     {
       SpawnRuleT<AdjustOrientationData>::SetRTTRValue(value);
 
-      data_.cosineAngle_ = glm::cos(data_.angle_.value_);
-      data_.sinAngle_ = glm::sin(data_.angle_.value_);
+      SinCos(data_.angle_.value_, data_.sinAngle_, data_.cosineAngle_);
     }
 
     void AdjustOrientation::Reflect()
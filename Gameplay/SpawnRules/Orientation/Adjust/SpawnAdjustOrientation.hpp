@@ -42,7 +42,7 @@ namespace Barrage
 
         std::shared_ptr<SpawnRule> Clone() const override;
 
-        void Execute(SpawnRuleInfo& info) override;
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
 
         void SetRTTRValue(const rttr::variant& value) override;
 
@@ -19,6 +19,7 @@
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
+#include "Math/Batch/BatchMath.hpp"
 #include "Utilities/Utilities.hpp"
 
 namespace Barrage
@@ -32,30 +33,32 @@ namespace Barrage
       return std::make_shared<IterateOrientation>(*this);
     }
 
-    void IterateOrientation::Execute(SpawnRuleInfo& info)
+    void IterateOrientation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      float& angle = dataArray_.Data(info.sourceIndex_).angle_.value_;
-      float cos_angle = glm::cos(angle);
-      float sin_angle = glm::sin(angle);
-      angle = ClampWrapped(angle + data_.angleStep_.value_, 0.0f, 2.0f * BARRAGE_PI);
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
+      unsigned dest_begin = info.startIndex_;
 
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        float& angle = dataArray_.Data(*it).angle_.value_;
+        float sin_angle;
+        float cos_angle;
+
+        SinCos(angle, sin_angle, cos_angle);
+
+        angle = WrapAngle(angle + data_.angleStep_.value_);
+
+        unsigned dest_count = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
+
+        for (unsigned i = dest_begin; i < dest_begin + dest_count; ++i)
         {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& dest_position = dest_positions.Data(dest_index);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
-
-            dest_position.Rotate(cos_angle, sin_angle);
-            dest_velocity.Rotate(angle);
-          }
+          dest_positions.Data(i).Rotate(cos_angle, sin_angle);
         }
+
+        RotateVelocities(dest_velocities, dest_begin, dest_count, cos_angle, sin_angle);
+
+        dest_begin += dest_count;
       }
     }
 
@@ -32,30 +32,28 @@ namespace Barrage
       return std::make_shared<MatchSpawnerOrientation>(*this);
     }
 
-    void MatchSpawnerOrientation::Execute(SpawnRuleInfo& info)
+    void MatchSpawnerOrientation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Velocity& sourceVelocity = info.sourcePool_.GetComponentArray<Velocity>("Velocity").Data(info.sourceIndex_);
-      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& sourceVelocities = info.sourcePool_.GetComponentArray<Velocity>();
+      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>();
+      unsigned destBegin = info.startIndex_;
 
-      float angle = sourceVelocity.GetAngle().value_;
-      float cosAngle = glm::cos(angle);
-      float sinAngle = glm::sin(angle);
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        Velocity sourceVelocity = sourceVelocities.Get(*it);
+        float cosAngle = sourceVelocity.GetCosAngle();
+        float sinAngle = sourceVelocity.GetSinAngle();
+        unsigned destCount = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
+
+        for (unsigned i = destBegin; i < destBegin + destCount; ++i)
         {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& destPosition = destPositions.Data(destIndex);
-            Velocity& destVelocity = destVelocities.Data(destIndex);
-
-            destPosition.Rotate(cosAngle, sinAngle);
-            destVelocity.Rotate(angle);
-          }
+          destPositions.Data(i).Rotate(cosAngle, sinAngle);
         }
+
+        RotateVelocities(destVelocities, destBegin, destCount, cosAngle, sinAngle);
+
+        destBegin += destCount;
       }
     }
   }
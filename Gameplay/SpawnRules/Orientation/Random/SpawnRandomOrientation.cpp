@@ -16,11 +16,10 @@
 
 #include <stdafx.h>
 #include "SpawnRandomOrientation.hpp"
-#include "Random/Random.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
 #include "Spaces/Space.hpp"
-#include "Utilities/Utilities.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
 
 namespace Barrage
 {
@@ -33,30 +32,19 @@ namespace Barrage
       return std::make_shared<RandomOrientation>(*this);
     }
 
-    void RandomOrientation::Execute(SpawnRuleInfo& info)
+    void RandomOrientation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Random& rng = info.space_.RNG();
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        float angle = BARRAGE_PI * rng.RangeFloat(0, 2.0f);
-        float cos_angle = glm::cos(angle);
-        float sin_angle = glm::sin(angle);
-
-        for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& dest_position = dest_positions.Data(dest_index);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
-
-            dest_position.Rotate(cos_angle, sin_angle);
-            dest_velocity.Rotate(angle);
-          }
-        }
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        ApplyRandomOrientations(dest_positions, dest_velocities, info.GetRandom(*it), group_info, start_index);
+        start_index += CalculateDestinationCount(group_info);
       }
     }
   }
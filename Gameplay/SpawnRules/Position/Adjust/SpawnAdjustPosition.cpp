@@ -29,25 +29,34 @@ namespace Barrage
       return std::make_shared<AdjustPosition>(*this);
     }
 
-    void AdjustPosition::Execute(SpawnRuleInfo& info)
+    void AdjustPosition::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>("Position");
+      PositionArray& dest_positions = info.destinationPool_.GetComponentArray<Position>();
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          glm::vec2 offset = data_.base_ + static_cast<float>(group) * data_.delta_;
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
 
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
+        for (unsigned layerCopy = 0; layerCopy < group_info.numLayerCopies_; ++layerCopy)
+        {
+          for (unsigned group = 0; group < group_info.numGroups_; ++group)
           {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& position = dest_positions.Data(dest_index);
+            glm::vec2 offset = data_.base_ + static_cast<float>(group) * data_.delta_;
+            unsigned group_index = CalculateDestinationIndex(group_info, start_index, 0, group, layerCopy);
 
-            position.x_ += offset.x;
-            position.y_ += offset.y;
+            for (unsigned dest_index = group_index; dest_index < group_index + group_info.numObjectsPerGroup_; ++dest_index)
+            {
+              Position& position = dest_positions.Data(dest_index);
+
+              position.x_ += offset.x;
+              position.y_ += offset.y;
+            }
           }
         }
+
+        start_index += CalculateDestinationCount(group_info);
       }
     }
 
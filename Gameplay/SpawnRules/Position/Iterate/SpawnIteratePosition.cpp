@@ -31,28 +31,27 @@ namespace Barrage
       return std::make_shared<IteratePosition>(*this);
     }
 
-    void IteratePosition::Execute(SpawnRuleInfo& info)
+    void IteratePosition::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      glm::vec2& offset = dataArray_.Data(info.sourceIndex_).offset_;
-      
-      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>("Position");
+      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>();
+      unsigned destBegin = info.startIndex_;
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        glm::vec2& offset = dataArray_.Data(*it).offset_;
+        unsigned destCount = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
+
+        for (unsigned i = destBegin; i < destBegin + destCount; ++i)
         {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& destPosition = destPositions.Data(destIndex);
+          Position& destPosition = destPositions.Data(i);
 
-            destPosition.x_ += offset.x;
-            destPosition.y_ += offset.y;
-          }
+          destPosition.x_ += offset.x;
+          destPosition.y_ += offset.y;
         }
-      }
 
-      offset += data_.positionStep_;
+        offset += data_.positionStep_;
+        destBegin += destCount;
+      }
     }
 
     void IteratePosition::Reflect()
@@ -47,7 +47,7 @@ namespace Barrage
 
       std::shared_ptr<SpawnRule> Clone() const override;
 
-      void Execute(SpawnRuleInfo& info) override;
+      void ExecuteBatch(SpawnRuleBatchInfo& info) override;
 
       static void Reflect();
     };
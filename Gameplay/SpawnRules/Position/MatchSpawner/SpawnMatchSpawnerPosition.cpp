@@ -30,24 +30,26 @@ namespace Barrage
       return std::make_shared<MatchSpawnerPosition>(*this);
     }
 
-    void MatchSpawnerPosition::Execute(SpawnRuleInfo& info)
+    void MatchSpawnerPosition::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Position& sourcePosition = info.sourcePool_.GetComponentArray<Position>("Position").Data(info.sourceIndex_);
-      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>("Position");
+      PositionArray& sourcePositions = info.sourcePool_.GetComponentArray<Position>();
+      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>();
+      unsigned destBegin = info.startIndex_;
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        Position& sourcePosition = sourcePositions.Data(*it);
+        unsigned destCount = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
+
+        for (unsigned i = destBegin; i < destBegin + destCount; ++i)
         {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& destPosition = destPositions.Data(destIndex);
-
-            destPosition.x_ += sourcePosition.x_;
-            destPosition.y_ += sourcePosition.y_;
-          }
+          Position& destPosition = destPositions.Data(i);
+
+          destPosition.x_ += sourcePosition.x_;
+          destPosition.y_ += sourcePosition.y_;
         }
+
+        destBegin += destCount;
       }
     }
   }
@@ -19,6 +19,7 @@
 #include "Spaces/Space.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "Objects/Pools/Pool.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
 
 namespace Barrage
 {
@@ -31,27 +32,18 @@ namespace Barrage
       return std::make_shared<RandomPositionBox>(*this);
     }
 
-    void RandomPositionBox::Execute(SpawnRuleInfo& info)
+    void RandomPositionBox::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Random& rng = info.space_.RNG();
-      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>("Position");
+      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>();
 
-      for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-      {
-        float xOffset = rng.RangeFloat(-data_.xVariance_, data_.xVariance_);
-        float yOffset = rng.RangeFloat(-data_.yVariance_, data_.yVariance_);
+      unsigned startIndex = info.startIndex_;
 
-        for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& destPosition = destPositions.Data(destIndex);
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+      {
+        GroupInfo& groupInfo = info.groupInfoArray_.Data(*it);
 
-            destPosition.x_ += xOffset;
-            destPosition.y_ += yOffset;
-          }
-        }
+        ApplyRandomPositionOffsets(destPositions, info.GetRandom(*it), groupInfo, startIndex, data_.xVariance_, data_.yVariance_);
+        startIndex += CalculateDestinationCount(groupInfo);
       }
     }
 
@@ -15,6 +15,8 @@
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 
+#include <algorithm>
+
 namespace Barrage
 {
   namespace Spawn
@@ -26,24 +28,11 @@ namespace Barrage
       return std::make_shared<SetPosition>(*this);
     }
 
-    void SetPosition::Execute(SpawnRuleInfo& info)
+    void SetPosition::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      PositionArray& destPositions = info.destinationPool_.GetComponentArray<Position>("Position");
-
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-      {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Position& destPosition = destPositions.Data(destIndex);
-
-            destPosition.x_ = data_.position_.x;
-            destPosition.y_ = data_.position_.y;
-          }
-        }
-      }
+      Position* destPositions = info.destinationPool_.GetComponentArray<Position>().GetRaw() + info.startIndex_;
+
+      std::fill(destPositions, destPositions + CalculateBatchCount(info), Position(data_.position_.x, data_.position_.y));
     }
 
     void SetPosition::Reflect()
@@ -17,6 +17,7 @@
 #include "SpawnAdjustRotation.hpp"
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Rotation/RotationArray.hpp"
+#include "Math/Batch/BatchMath.hpp"
 
 namespace Barrage
 {
@@ -29,22 +30,14 @@ namespace Barrage
       return std::make_shared<AdjustRotation>(*this);
     }
 
-    void AdjustRotation::Execute(SpawnRuleInfo& info)
+    void AdjustRotation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>("Rotation");
+      Rotation* destRotations = info.destinationPool_.GetComponentArray<Rotation>().GetRaw() + info.startIndex_;
+      unsigned destCount = CalculateBatchCount(info);
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (unsigned i = 0; i < destCount; ++i)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Rotation& destRotation = destRotations.Data(dest_index);
-
-            destRotation.angle_.value_ = ClampWrapped(destRotation.angle_.value_ + data_.angle_.value_, 0.0f, 2.0f * BARRAGE_PI);
-          }
-        }
+        destRotations[i].angle_.value_ = WrapAngle(destRotations[i].angle_.value_ + data_.angle_.value_);
       }
     }
 
@@ -18,6 +18,7 @@
 #include "SpawnIterateRotation.hpp"
 #include "Objects/Pools/Pool.hpp"
 #include "ComponentArrays/Rotation/RotationArray.hpp"
+#include "Math/Batch/BatchMath.hpp"
 #include "Utilities/Utilities.hpp"
 
 namespace Barrage
@@ -31,26 +32,24 @@ namespace Barrage
       return std::make_shared<IterateRotation>(*this);
     }
 
-    void IterateRotation::Execute(SpawnRuleInfo& info)
+    void IterateRotation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      float& angle = dataArray_.Data(info.sourceIndex_).angle_.value_;
-      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>("Rotation");
+      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>();
+      unsigned destBegin = info.startIndex_;
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Rotation& destRotation = destRotations.Data(destIndex);
+        float& angle = dataArray_.Data(*it).angle_.value_;
+        unsigned destCount = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
 
-            destRotation.angle_.value_ += angle;
-          }
+        for (unsigned i = destBegin; i < destBegin + destCount; ++i)
+        {
+          destRotations.Data(i).angle_.value_ += angle;
         }
-      }
 
-      angle = ClampWrapped(angle + data_.angleStep_.value_, 0.0f, 2.0f * BARRAGE_PI);
+        angle = WrapAngle(angle + data_.angleStep_.value_);
+        destBegin += destCount;
+      }
     }
 
     void IterateRotation::Reflect()
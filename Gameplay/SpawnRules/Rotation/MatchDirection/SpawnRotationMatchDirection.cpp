@@ -32,24 +32,15 @@ namespace Barrage
       return std::make_shared<RotationMatchDirection>(*this);
     }
 
-    void RotationMatchDirection::Execute(SpawnRuleInfo& info)
+    void RotationMatchDirection::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>("Rotation");
-      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>();
+      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>();
+      unsigned destEnd = info.startIndex_ + CalculateBatchCount(info);
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (unsigned i = info.startIndex_; i < destEnd; ++i)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Rotation& destRotation = destRotations.Data(destIndex);
-            Velocity& destVelocity = destVelocities.Data(destIndex);
-            
-            destRotation.angle_ = destVelocity.GetAngle();
-          }
-        }
+        destRotations.Data(i).angle_ = destVelocities.Get(i).GetAngle();
       }
     }
   }
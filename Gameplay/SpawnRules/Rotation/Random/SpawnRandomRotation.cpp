@@ -12,9 +12,9 @@
 
 #include <stdafx.h>
 #include "SpawnRandomRotation.hpp"
-#include "Random/Random.hpp"
 #include "ComponentArrays/Rotation/RotationArray.hpp"
 #include "Spaces/Space.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
 
 namespace Barrage
 {
@@ -27,25 +27,18 @@ namespace Barrage
       return std::make_shared<RandomRotation>(*this);
     }
 
-    void RandomRotation::Execute(SpawnRuleInfo& info)
+    void RandomRotation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Random& rng = info.space_.RNG();
-      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>("Rotation");
+      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>();
 
-      for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+      unsigned startIndex = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        float angle = rng.RangeFloat(0, 2.0f * BARRAGE_PI);
-
-        for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Rotation& destRotation = destRotations.Data(destIndex);
-
-            destRotation.angle_ = angle;
-          }
-        }
+        GroupInfo& groupInfo = info.groupInfoArray_.Data(*it);
+
+        ApplyRandomRotations(destRotations, info.GetRandom(*it), groupInfo, startIndex);
+        startIndex += CalculateDestinationCount(groupInfo);
       }
     }
   }
@@ -29,22 +29,14 @@ namespace Barrage
       return std::make_shared<SetRotation>(*this);
     }
 
-    void SetRotation::Execute(SpawnRuleInfo& info)
+    void SetRotation::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      RotationArray& destRotations = info.destinationPool_.GetComponentArray<Rotation>("Rotation");
+      Rotation* destRotations = info.destinationPool_.GetComponentArray<Rotation>().GetRaw() + info.startIndex_;
+      unsigned destCount = CalculateBatchCount(info);
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (unsigned i = 0; i < destCount; ++i)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Rotation& destRotation = destRotations.Data(destIndex);
-
-            destRotation.angle_.value_ = data_.angle_.value_;
-          }
-        }
+        destRotations[i].angle_.value_ = data_.angle_.value_;
       }
     }
 
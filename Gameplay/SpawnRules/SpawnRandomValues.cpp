@@ -0,0 +1,217 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRandomValues.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The math behind the random spawn rules, run on one spawner's objects at
+   a time. Each group of objects gets one value, drawn from the spawner's
+   random stream at the group's index. The rules call these once per
+   spawner; the determinism check calls them on bare arrays.
+ */
+ /* ======================================================================== */
+
+#include <stdafx.h>
+#include "SpawnRandomValues.hpp"
+#include "Math/Batch/BatchMath.hpp"
+#include "Objects/Spawning/SpawnType.hpp"
+#include "Utilities/Utilities.hpp"
+
+#include <algorithm>
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    void ApplyRandomAccelerations(AccelerationArray& accelerations, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float minAcceleration, float maxAcceleration)
+    {
+      float values[SpawnType::TILE_SIZE];
+
+      // a spawner with more groups than a tile draws its values a tile at a time
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        random.FillFloats(values, firstGroup, numGroups, minAcceleration, maxAcceleration);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            for (unsigned object = groupIndex; object < groupIndex + groupInfo.numObjectsPerGroup_; ++object)
+            {
+              accelerations.Data(object).a_ = values[group - firstGroup];
+            }
+          }
+        }
+      }
+    }
+
+    void ApplyRandomDirections(VelocityArray& velocities, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex)
+    {
+      float sines[SpawnType::TILE_SIZE];
+      float cosines[SpawnType::TILE_SIZE];
+
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        // the angles are drawn into the sine array, then replaced by their sines
+        random.FillFloats(sines, firstGroup, numGroups, 0, 2.0f * BARRAGE_PI);
+        SinCos(sines, sines, cosines, numGroups);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            SetVelocityDirections(velocities, groupIndex, groupInfo.numObjectsPerGroup_, cosines[group - firstGroup], sines[group - firstGroup]);
+          }
+        }
+      }
+    }
+
+    void ApplyRandomOrientations(PositionArray& positions, VelocityArray& velocities, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex)
+    {
+      float sines[SpawnType::TILE_SIZE];
+      float cosines[SpawnType::TILE_SIZE];
+
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        // each group's angle is the same in every layer copy, so its trig is done once
+        random.FillFloats(sines, firstGroup, numGroups, 0, 2.0f * BARRAGE_PI);
+        SinCos(sines, sines, cosines, numGroups);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          float sinAngle = sines[group - firstGroup];
+          float cosAngle = cosines[group - firstGroup];
+
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            for (unsigned object = groupIndex; object < groupIndex + groupInfo.numObjectsPerGroup_; ++object)
+            {
+              positions.Data(object).Rotate(cosAngle, sinAngle);
+            }
+
+            RotateVelocities(velocities, groupIndex, groupInfo.numObjectsPerGroup_, cosAngle, sinAngle);
+          }
+        }
+      }
+    }
+
+    void ApplyRandomPositionOffsets(PositionArray& positions, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float xVariance, float yVariance)
+    {
+      float xOffsets[SpawnType::TILE_SIZE];
+      float yOffsets[SpawnType::TILE_SIZE];
+
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        random.FillFloats(xOffsets, firstGroup, numGroups, -xVariance, xVariance);
+        random.FillFloats(yOffsets, groupInfo.numGroups_ + firstGroup, numGroups, -yVariance, yVariance);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          float xOffset = xOffsets[group - firstGroup];
+          float yOffset = yOffsets[group - firstGroup];
+
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            for (unsigned object = groupIndex; object < groupIndex + groupInfo.numObjectsPerGroup_; ++object)
+            {
+              Position& position = positions.Data(object);
+
+              position.x_ += xOffset;
+              position.y_ += yOffset;
+            }
+          }
+        }
+      }
+    }
+
+    void ApplyRandomRotations(RotationArray& rotations, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex)
+    {
+      float angles[SpawnType::TILE_SIZE];
+
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        random.FillFloats(angles, firstGroup, numGroups, 0, 2.0f * BARRAGE_PI);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            for (unsigned object = groupIndex; object < groupIndex + groupInfo.numObjectsPerGroup_; ++object)
+            {
+              rotations.Data(object).angle_ = angles[group - firstGroup];
+            }
+          }
+        }
+      }
+    }
+
+    void ApplyRandomSpeeds(VelocityArray& velocities, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float minSpeed, float maxSpeed)
+    {
+      float speeds[SpawnType::TILE_SIZE];
+
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        random.FillFloats(speeds, firstGroup, numGroups, minSpeed, maxSpeed);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            SetVelocitySpeeds(velocities, groupIndex, groupInfo.numObjectsPerGroup_, speeds[group - firstGroup]);
+          }
+        }
+      }
+    }
+
+    void ApplyRandomTurnRates(TurnRateArray& turnRates, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float minTurnRate, float maxTurnRate)
+    {
+      float values[SpawnType::TILE_SIZE];
+
+      for (unsigned firstGroup = 0; firstGroup < groupInfo.numGroups_; firstGroup += SpawnType::TILE_SIZE)
+      {
+        unsigned numGroups = std::min(groupInfo.numGroups_ - firstGroup, SpawnType::TILE_SIZE);
+
+        random.FillFloats(values, firstGroup, numGroups, minTurnRate, maxTurnRate);
+
+        for (unsigned group = firstGroup; group < firstGroup + numGroups; ++group)
+        {
+          for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+          {
+            unsigned groupIndex = groupInfo.GetObjectIndex(startIndex, 0, group, layerCopy);
+
+            for (unsigned object = groupIndex; object < groupIndex + groupInfo.numObjectsPerGroup_; ++object)
+            {
+              turnRates.Data(object).w_.value_ = values[group - firstGroup];
+            }
+          }
+        }
+      }
+    }
+  }
+}
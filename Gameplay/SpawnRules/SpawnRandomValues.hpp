@@ -0,0 +1,209 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRandomValues.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The math behind the random spawn rules, run on one spawner's objects at
+   a time. Each group of objects gets one value, drawn from the spawner's
+   random stream at the group's index. The rules call these once per
+   spawner; the determinism check calls them on bare arrays.
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SpawnRandomValues_BARRAGE_H
+#define SpawnRandomValues_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Spawning/SpawnRule.hpp"
+#include "ComponentArrays/Acceleration/AccelerationArray.hpp"
+#include "ComponentArrays/Position/PositionArray.hpp"
+#include "ComponentArrays/Rotation/RotationArray.hpp"
+#include "ComponentArrays/TurnRate/TurnRateArray.hpp"
+#include "ComponentArrays/Velocity/VelocityArray.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    /**************************************************************/
+    /*!
+      \brief
+        Gives each group of a spawner's objects a random
+        acceleration.
+
+      \param accelerations
+        The destination pool's accelerations.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+
+      \param minAcceleration
+        The smallest acceleration.
+
+      \param maxAcceleration
+        The largest acceleration.
+    */
+    /**************************************************************/
+    void ApplyRandomAccelerations(AccelerationArray& accelerations, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float minAcceleration, float maxAcceleration);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Points each group of a spawner's objects in a random
+        direction. Speeds are kept.
+
+      \param velocities
+        The destination pool's velocities.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+    */
+    /**************************************************************/
+    void ApplyRandomDirections(VelocityArray& velocities, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Rotates the positions and velocities of each group of a
+        spawner's objects by a random angle.
+
+      \param positions
+        The destination pool's positions.
+
+      \param velocities
+        The destination pool's velocities.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+    */
+    /**************************************************************/
+    void ApplyRandomOrientations(PositionArray& positions, VelocityArray& velocities, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Moves each group of a spawner's objects by a random offset
+        inside a box. The stream holds every group's x offset, then
+        every group's y offset.
+
+      \param positions
+        The destination pool's positions.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+
+      \param xVariance
+        The largest x offset either way.
+
+      \param yVariance
+        The largest y offset either way.
+    */
+    /**************************************************************/
+    void ApplyRandomPositionOffsets(PositionArray& positions, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float xVariance, float yVariance);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Gives each group of a spawner's objects a random rotation.
+
+      \param rotations
+        The destination pool's rotations.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+    */
+    /**************************************************************/
+    void ApplyRandomRotations(RotationArray& rotations, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Gives each group of a spawner's objects a random speed.
+        Directions are kept.
+
+      \param velocities
+        The destination pool's velocities.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+
+      \param minSpeed
+        The smallest speed.
+
+      \param maxSpeed
+        The largest speed.
+    */
+    /**************************************************************/
+    void ApplyRandomSpeeds(VelocityArray& velocities, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float minSpeed, float maxSpeed);
+
+    /**************************************************************/
+    /*!
+      \brief
+        Gives each group of a spawner's objects a random turn rate.
+
+      \param turnRates
+        The destination pool's turn rates.
+
+      \param random
+        The spawner's random stream for this rule.
+
+      \param groupInfo
+        The spawner's group sizes.
+
+      \param startIndex
+        Index of the spawner's first object.
+
+      \param minTurnRate
+        The smallest turn rate.
+
+      \param maxTurnRate
+        The largest turn rate.
+    */
+    /**************************************************************/
+    void ApplyRandomTurnRates(TurnRateArray& turnRates, const CounterRandom& random, const GroupInfo& groupInfo, unsigned startIndex, float minTurnRate, float maxTurnRate);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SpawnRandomValues_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
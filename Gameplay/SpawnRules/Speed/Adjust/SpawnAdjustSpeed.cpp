@@ -29,24 +29,28 @@ namespace Barrage
       return std::make_shared<AdjustSpeed>(*this);
     }
 
-    void AdjustSpeed::Execute(SpawnRuleInfo& info)
+    void AdjustSpeed::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      unsigned startIndex = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          float speed = data_.base_ + static_cast<float>(group) * data_.delta_;
+        GroupInfo& groupInfo = info.groupInfoArray_.Data(*it);
 
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
+        for (unsigned layerCopy = 0; layerCopy < groupInfo.numLayerCopies_; ++layerCopy)
+        {
+          for (unsigned group = 0; group < groupInfo.numGroups_; ++group)
           {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& velocity = destVelocities.Data(destIndex);
+            float speed = data_.base_ + static_cast<float>(group) * data_.delta_;
+            unsigned groupIndex = CalculateDestinationIndex(groupInfo, startIndex, 0, group, layerCopy);
 
-            velocity.AddSpeed(speed);
+            AddVelocitySpeeds(destVelocities, groupIndex, groupInfo.numObjectsPerGroup_, speed);
           }
         }
+
+        startIndex += CalculateDestinationCount(groupInfo);
       }
     }
 
@@ -31,26 +31,21 @@ namespace Barrage
       return std::make_shared<IterateSpeed>(*this);
     }
 
-    void IterateSpeed::Execute(SpawnRuleInfo& info)
+    void IterateSpeed::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      float& speed = dataArray_.Data(info.sourceIndex_).speed_;
-      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& destVelocities = info.destinationPool_.GetComponentArray<Velocity>();
+      unsigned destBegin = info.startIndex_;
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned destIndex = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& destVelocity = destVelocities.Data(destIndex);
+        float& speed = dataArray_.Data(*it).speed_;
+        unsigned destCount = CalculateDestinationCount(info.groupInfoArray_.Data(*it));
 
-            destVelocity.AddSpeed(speed);
-          }
-        }
-      }
+        AddVelocitySpeeds(destVelocities, destBegin, destCount, speed);
 
-      speed += data_.speedStep_;
+        speed += data_.speedStep_;
+        destBegin += destCount;
+      }
     }
 
     void IterateSpeed::Reflect()
@@ -17,6 +17,7 @@
 #include "SpawnRandomSpeed.hpp"
 #include "Objects/Pools/Pool.hpp"
 #include "Spaces/Space.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
 
 namespace Barrage
 {
@@ -29,25 +30,18 @@ namespace Barrage
       return std::make_shared<RandomSpeed>(*this);
     }
 
-    void RandomSpeed::Execute(SpawnRuleInfo& info)
+    void RandomSpeed::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      Random& rng = info.space_.RNG();
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
-      {
-        float speed = rng.RangeFloat(data_.minSpeed_, data_.maxSpeed_);
+      unsigned start_index = info.startIndex_;
 
-        for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
-        {
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
-          {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+      {
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
 
-            dest_velocity.SetSpeed(speed);
-          }
-        }
+        ApplyRandomSpeeds(dest_velocities, info.GetRandom(*it), group_info, start_index, data_.minSpeed_, data_.maxSpeed_);
+        start_index += CalculateDestinationCount(group_info);
       }
     }
 
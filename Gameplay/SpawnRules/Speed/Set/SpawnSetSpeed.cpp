@@ -29,24 +29,28 @@ namespace Barrage
       return std::make_shared<SetSpeed>(*this);
     }
 
-    void SetSpeed::Execute(SpawnRuleInfo& info)
+    void SetSpeed::ExecuteBatch(SpawnRuleBatchInfo& info)
     {
-      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>("Velocity");
+      VelocityArray& dest_velocities = info.destinationPool_.GetComponentArray<Velocity>();
 
-      for (unsigned layerCopy = 0; layerCopy < info.groupInfo_.numLayerCopies_; ++layerCopy)
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
       {
-        for (unsigned group = 0; group < info.groupInfo_.numGroups_; ++group)
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        for (unsigned layerCopy = 0; layerCopy < group_info.numLayerCopies_; ++layerCopy)
         {
-          float speed = data_.baseSpeed_ + group * data_.delta_;
-          
-          for (unsigned object = 0; object < info.groupInfo_.numObjectsPerGroup_; ++object)
+          for (unsigned group = 0; group < group_info.numGroups_; ++group)
           {
-            unsigned dest_index = CalculateDestinationIndex(info, object, group, layerCopy);
-            Velocity& dest_velocity = dest_velocities.Data(dest_index);
-            
-            dest_velocity.SetSpeed(speed);
+            float speed = data_.baseSpeed_ + group * data_.delta_;
+            unsigned group_index = CalculateDestinationIndex(group_info, start_index, 0, group, layerCopy);
+
+            SetVelocitySpeeds(dest_velocities, group_index, group_info.numObjectsPerGroup_, speed);
           }
         }
+
+        start_index += CalculateDestinationCount(group_info);
       }
     }
 
@@ -0,0 +1,68 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRandomTurnRate.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives each spawned group a random turn rate between the minimum and
+   maximum.
+
+   Requirements:
+   - TurnRate (destination)
+ */
+ /* ======================================================================== */
+
+#include <stdafx.h>
+#include "SpawnRandomTurnRate.hpp"
+#include "Objects/Pools/Pool.hpp"
+#include "Spaces/Space.hpp"
+#include "SpawnRules/SpawnRandomValues.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    RandomTurnRate::RandomTurnRate() : SpawnRuleT<RandomTurnRateData>("RandomTurnRate") {}
+
+    std::shared_ptr<SpawnRule> RandomTurnRate::Clone() const
+    {
+      return std::make_shared<RandomTurnRate>(*this);
+    }
+
+    void RandomTurnRate::ExecuteBatch(SpawnRuleBatchInfo& info)
+    {
+      TurnRateArray& dest_turn_rates = info.destinationPool_.GetComponentArray<TurnRate>();
+
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+      {
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        ApplyRandomTurnRates(dest_turn_rates, info.GetRandom(*it), group_info, start_index, data_.minTurnRate_.value_, data_.maxTurnRate_.value_);
+        start_index += CalculateDestinationCount(group_info);
+      }
+    }
+
+    void RandomTurnRate::SetRTTRValue(const rttr::variant& value)
+    {
+      SpawnRuleT<RandomTurnRateData>::SetRTTRValue(value);
+
+      if (data_.maxTurnRate_.value_ < data_.minTurnRate_.value_)
+      {
+        data_.maxTurnRate_ = data_.minTurnRate_;
+      }
+    }
+
+    void RandomTurnRate::Reflect()
+    {
+      rttr::registration::class_<Spawn::RandomTurnRateData>("RandomTurnRateData")
+        .constructor<>() (rttr::policy::ctor::as_object)
+        .property("minTurnRate", &Spawn::RandomTurnRateData::minTurnRate_)
+        .property("maxTurnRate", &Spawn::RandomTurnRateData::maxTurnRate_)
+        ;
+    }
+  }
+}
\ No newline at end of file
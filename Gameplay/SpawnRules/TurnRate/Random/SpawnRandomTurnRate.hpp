@@ -0,0 +1,55 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnRandomTurnRate.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives each spawned group a random turn rate between the minimum and
+   maximum.
+
+   Requirements:
+   - TurnRate (destination)
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SpawnRandomTurnRate_BARRAGE_H
+#define SpawnRandomTurnRate_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Spawning/SpawnRule.hpp"
+#include "ComponentArrays/TurnRate/TurnRateArray.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    struct RandomTurnRateData
+    {
+      Radian minTurnRate_;
+      Radian maxTurnRate_;
+
+      inline RandomTurnRateData() : minTurnRate_(0.0f), maxTurnRate_(0.0f) {};
+    };
+    
+    class RandomTurnRate : public SpawnRuleT<RandomTurnRateData>
+    {
+      public:
+        RandomTurnRate();
+
+        std::shared_ptr<SpawnRule> Clone() const override;
+
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
+
+        void SetRTTRValue(const rttr::variant& value) override;
+
+        static void Reflect();
+    };
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SpawnRandomTurnRate_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,69 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnSetTurnRate.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives spawned objects a turn rate. Each group gets the base turn rate
+   plus delta times the group's index.
+
+   Requirements:
+   - TurnRate (destination)
+ */
+ /* ======================================================================== */
+
+#include <stdafx.h>
+#include "SpawnSetTurnRate.hpp"
+#include "Objects/Pools/Pool.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    SetTurnRate::SetTurnRate() : SpawnRuleT<SetTurnRateData>("SetTurnRate") {}
+
+    std::shared_ptr<SpawnRule> SetTurnRate::Clone() const
+    {
+      return std::make_shared<SetTurnRate>(*this);
+    }
+
+    void SetTurnRate::ExecuteBatch(SpawnRuleBatchInfo& info)
+    {
+      TurnRateArray& dest_turn_rates = info.destinationPool_.GetComponentArray<TurnRate>();
+
+      unsigned start_index = info.startIndex_;
+
+      for (auto it = info.sourceIndices_.begin(); it != info.sourceIndices_.end(); ++it)
+      {
+        GroupInfo& group_info = info.groupInfoArray_.Data(*it);
+
+        for (unsigned layerCopy = 0; layerCopy < group_info.numLayerCopies_; ++layerCopy)
+        {
+          for (unsigned group = 0; group < group_info.numGroups_; ++group)
+          {
+            float turn_rate = data_.baseTurnRate_.value_ + group * data_.delta_.value_;
+            unsigned group_index = CalculateDestinationIndex(group_info, start_index, 0, group, layerCopy);
+
+            for (unsigned object = 0; object < group_info.numObjectsPerGroup_; ++object)
+            {
+              dest_turn_rates.Data(group_index + object).w_.value_ = turn_rate;
+            }
+          }
+        }
+
+        start_index += CalculateDestinationCount(group_info);
+      }
+    }
+
+    void SetTurnRate::Reflect()
+    {
+      rttr::registration::class_<Spawn::SetTurnRateData>("SetTurnRateData")
+        .constructor<>() (rttr::policy::ctor::as_object)
+        .property("baseTurnRate", &Spawn::SetTurnRateData::baseTurnRate_)
+        .property("delta", &Spawn::SetTurnRateData::delta_)
+        ;
+    }
+  }
+}
\ No newline at end of file
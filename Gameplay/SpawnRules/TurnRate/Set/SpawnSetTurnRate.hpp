@@ -0,0 +1,53 @@
+/* ======================================================================== */
+/*!
+ * \file            SpawnSetTurnRate.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Gives spawned objects a turn rate. Each group gets the base turn rate
+   plus delta times the group's index.
+
+   Requirements:
+   - TurnRate (destination)
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SpawnSetTurnRate_BARRAGE_H
+#define SpawnSetTurnRate_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Objects/Spawning/SpawnRule.hpp"
+#include "ComponentArrays/TurnRate/TurnRateArray.hpp"
+
+namespace Barrage
+{
+  namespace Spawn
+  {
+    struct SetTurnRateData
+    {
+      Radian baseTurnRate_;
+      Radian delta_;
+
+      inline SetTurnRateData() : baseTurnRate_(0.0f), delta_(0.0f) {};
+    };
+    
+    class SetTurnRate : public SpawnRuleT<SetTurnRateData>
+    {
+      public:
+        SetTurnRate();
+
+        std::shared_ptr<SpawnRule> Clone() const override;
+
+        void ExecuteBatch(SpawnRuleBatchInfo& info) override;
+
+        static void Reflect();
+    };
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // SpawnSetTurnRate_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -25,6 +25,11 @@ namespace Barrage
     PoolType behavior_type;
     behavior_type.AddComponent("BehaviorTree");
     poolTypes_[BEHAVIOR_POOLS] = behavior_type;
+
+    // behavior nodes can touch anything in their pool
+    PoolAccess behavior_access;
+    behavior_access.WriteAll();
+    poolAccess_[BEHAVIOR_POOLS] = behavior_access;
   }
 
   void BehaviorSystem::Subscribe(Space& space, Pool* pool)
@@ -35,7 +40,7 @@ namespace Barrage
 
       if (pool_type.MatchesPool(pool))
       {
-        BehaviorTree& behaviorTree = pool->GetComponent<BehaviorTree>("BehaviorTree").Data();
+        BehaviorTree& behaviorTree = pool->GetComponent<BehaviorTree>().Data();
         behaviorTree.BuildTree();
 
         poolGroups_[it->first].push_back(pool);
@@ -50,7 +55,7 @@ namespace Barrage
 
   void BehaviorSystem::ExecuteBehaviorTree(Space& space, Pool& pool)
   {
-    BehaviorTree& behaviorTree = pool.GetComponent<BehaviorTree>("BehaviorTree").Data();
+    BehaviorTree& behaviorTree = pool.GetComponent<BehaviorTree>().Data();
     
     behaviorTree.Execute(space, pool);
   }
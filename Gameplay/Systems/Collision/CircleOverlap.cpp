@@ -0,0 +1,212 @@
+/* ======================================================================== */
+/*!
+ * \file            CircleOverlap.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Narrowphase kernels that test one circle against a run of circles and
+   report the hits as a bitmask. The SIMD versions (SSE2, and AVX2 when
+   the CPU supports it) give exactly the same results as the scalar one.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "CircleOverlap.hpp"
+#include "Utilities/Utilities.hpp"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BARRAGE_X64
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define BARRAGE_TARGET_AVX2
+#else
+#define BARRAGE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace Barrage
+{
+  namespace
+  {
+    void ClearHitMask(uint64_t* hitMask, unsigned count)
+    {
+      std::memset(hitMask, 0, (count + HIT_MASK_BITS - 1) / HIT_MASK_BITS * sizeof(uint64_t));
+    }
+
+    // tests circles [begin, count) one at a time; shared by every kernel for its leftovers
+    unsigned CircleOverlapTail(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned begin, unsigned count, uint64_t* hitMask)
+    {
+      unsigned numHits = 0;
+
+      for (unsigned i = begin; i < count; ++i)
+      {
+        float deltaX = xs[i] - x;
+        float deltaY = ys[i] - y;
+        float sumRadii = radii[i] + radius;
+
+        if (deltaX * deltaX + deltaY * deltaY <= sumRadii * sumRadii)
+        {
+          hitMask[i / HIT_MASK_BITS] |= uint64_t(1) << (i % HIT_MASK_BITS);
+          ++numHits;
+        }
+      }
+
+      return numHits;
+    }
+  }
+
+  unsigned CircleOverlap(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    static const CircleOverlapFunction kernel = CpuSupportsAVX2() ? CircleOverlapAVX2 : CircleOverlapSSE2;
+
+    return kernel(x, y, radius, xs, ys, radii, count, hitMask);
+  }
+
+  unsigned CircleOverlapScalar(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    ClearHitMask(hitMask, count);
+
+    return CircleOverlapTail(x, y, radius, xs, ys, radii, 0, count, hitMask);
+  }
+
+  unsigned SweptCircleOverlap(float x, float y, float previousX, float previousY, float radius, const float* xs, const float* ys, const float* previousXs, const float* previousYs, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    ClearHitMask(hitMask, count);
+
+    unsigned numHits = 0;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      // offset between the circles at the end of the tick, and how it changed over the tick
+      float deltaX = xs[i] - x;
+      float deltaY = ys[i] - y;
+      float motionX = deltaX - (previousXs[i] - previousX);
+      float motionY = deltaY - (previousYs[i] - previousY);
+      float motionSquared = motionX * motionX + motionY * motionY;
+
+      // walk back from the end offset to the point on the path closest to touching
+      if (motionSquared > 0.0f)
+      {
+        float t = (deltaX * motionX + deltaY * motionY) / motionSquared;
+
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+
+        deltaX -= t * motionX;
+        deltaY -= t * motionY;
+      }
+
+      float sumRadii = radii[i] + radius;
+
+      if (deltaX * deltaX + deltaY * deltaY <= sumRadii * sumRadii)
+      {
+        hitMask[i / HIT_MASK_BITS] |= uint64_t(1) << (i % HIT_MASK_BITS);
+        ++numHits;
+      }
+    }
+
+    return numHits;
+  }
+
+#ifdef BARRAGE_X64
+  unsigned CircleOverlapSSE2(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    ClearHitMask(hitMask, count);
+
+    const __m128 centerX = _mm_set1_ps(x);
+    const __m128 centerY = _mm_set1_ps(y);
+    const __m128 centerRadius = _mm_set1_ps(radius);
+
+    unsigned numHits = 0;
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 deltaX = _mm_sub_ps(_mm_loadu_ps(xs + i), centerX);
+      __m128 deltaY = _mm_sub_ps(_mm_loadu_ps(ys + i), centerY);
+      __m128 sumRadii = _mm_add_ps(_mm_loadu_ps(radii + i), centerRadius);
+
+      __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(deltaX, deltaX), _mm_mul_ps(deltaY, deltaY));
+      unsigned hits = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(distanceSquared, _mm_mul_ps(sumRadii, sumRadii))));
+
+      // groups of four never straddle a mask word since 64 is a multiple of four
+      hitMask[i / HIT_MASK_BITS] |= uint64_t(hits) << (i % HIT_MASK_BITS);
+      numHits += CountSetBits(hits);
+    }
+
+    return numHits + CircleOverlapTail(x, y, radius, xs, ys, radii, i, count, hitMask);
+  }
+
+  BARRAGE_TARGET_AVX2
+  unsigned CircleOverlapAVX2(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    ClearHitMask(hitMask, count);
+
+    const __m256 centerX = _mm256_set1_ps(x);
+    const __m256 centerY = _mm256_set1_ps(y);
+    const __m256 centerRadius = _mm256_set1_ps(radius);
+
+    unsigned numHits = 0;
+    unsigned i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+      __m256 deltaX = _mm256_sub_ps(_mm256_loadu_ps(xs + i), centerX);
+      __m256 deltaY = _mm256_sub_ps(_mm256_loadu_ps(ys + i), centerY);
+      __m256 sumRadii = _mm256_add_ps(_mm256_loadu_ps(radii + i), centerRadius);
+
+      // separate multiplies and adds (no FMA) so results match the scalar kernel bit for bit
+      __m256 distanceSquared = _mm256_add_ps(_mm256_mul_ps(deltaX, deltaX), _mm256_mul_ps(deltaY, deltaY));
+      unsigned hits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(distanceSquared, _mm256_mul_ps(sumRadii, sumRadii), _CMP_LE_OQ)));
+
+      hitMask[i / HIT_MASK_BITS] |= uint64_t(hits) << (i % HIT_MASK_BITS);
+      numHits += CountSetBits(hits);
+    }
+
+    return numHits + CircleOverlapTail(x, y, radius, xs, ys, radii, i, count, hitMask);
+  }
+
+  bool CpuSupportsAVX2()
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+
+    __cpuid(info, 0);
+
+    if (info[0] < 7)
+    {
+      return false;
+    }
+
+    __cpuid(info, 1);
+
+    const bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 0x6) == 0x6);
+
+    __cpuidex(info, 7, 0);
+
+    return osSavesYmm && (info[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+  }
+#else
+  unsigned CircleOverlapSSE2(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    return CircleOverlapScalar(x, y, radius, xs, ys, radii, count, hitMask);
+  }
+
+  unsigned CircleOverlapAVX2(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask)
+  {
+    return CircleOverlapScalar(x, y, radius, xs, ys, radii, count, hitMask);
+  }
+
+  bool CpuSupportsAVX2()
+  {
+    return false;
+  }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+/* ======================================================================== */
+/*!
+ * \file            CircleOverlap.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Narrowphase kernels that test one circle against a run of circles and
+   report the hits as a bitmask. The SIMD versions (SSE2, and AVX2 when
+   the CPU supports it) give exactly the same results as the scalar one.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CircleOverlap_BARRAGE_H
+#define CircleOverlap_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+
+namespace Barrage
+{
+  constexpr unsigned HIT_MASK_BITS = 64;   //!< Circles covered by each word of a hit mask
+  constexpr unsigned QUERY_RUN_SIZE = 256; //!< Most circles a collision grid query tests per narrowphase call
+
+  //! Tests one circle against many; see CircleOverlap() for parameters
+  using CircleOverlapFunction = unsigned (*)(float, float, float, const float*, const float*, const float*, unsigned, uint64_t*);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Tests a circle against a run of circles. Circle i is hit if
+      the squared distance between the centers is at most the
+      square of the summed radii (touching counts as a hit).
+
+      Uses the fastest kernel the CPU supports, picked the first
+      time it's called.
+
+    \param x
+      X coordinate of the circle's center.
+
+    \param y
+      Y coordinate of the circle's center.
+
+    \param radius
+      Radius of the circle.
+
+    \param xs
+      X coordinates of the other circles' centers.
+
+    \param ys
+      Y coordinates of the other circles' centers.
+
+    \param radii
+      Radii of the other circles.
+
+    \param count
+      Number of other circles.
+
+    \param hitMask
+      Receives one bit per circle (bit i % 64 of word i / 64). Must
+      hold at least (count + 63) / 64 words. Bits past count are
+      cleared.
+
+    \return
+      Returns the number of hits.
+  */
+  /**************************************************************/
+  unsigned CircleOverlap(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Reference version of CircleOverlap() without SIMD.
+  */
+  /**************************************************************/
+  unsigned CircleOverlapScalar(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask);
+
+  /**************************************************************/
+  /*!
+    \brief
+      SSE2 version of CircleOverlap(), four circles at a time.
+      Falls back to the scalar version on CPUs without SSE2.
+  */
+  /**************************************************************/
+  unsigned CircleOverlapSSE2(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask);
+
+  /**************************************************************/
+  /*!
+    \brief
+      AVX2 version of CircleOverlap(), eight circles at a time.
+      Only call this if the CPU supports AVX2 (falls back to the
+      scalar version where it can't be compiled).
+  */
+  /**************************************************************/
+  unsigned CircleOverlapAVX2(float x, float y, float radius, const float* xs, const float* ys, const float* radii, unsigned count, uint64_t* hitMask);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Swept version of CircleOverlap(). Every circle moved in a
+      straight line from its previous position to its current one
+      during the tick, and circle i is hit if the two circles came
+      within the sum of their radii at any point along the way.
+
+      Circles that didn't move (previous position equal to the
+      current one) give exactly the same result as CircleOverlap().
+
+    \param x
+      X coordinate of the circle's current center.
+
+    \param y
+      Y coordinate of the circle's current center.
+
+    \param previousX
+      X coordinate of the circle's center at the start of the tick.
+
+    \param previousY
+      Y coordinate of the circle's center at the start of the tick.
+
+    \param radius
+      Radius of the circle.
+
+    \param xs
+      X coordinates of the other circles' current centers.
+
+    \param ys
+      Y coordinates of the other circles' current centers.
+
+    \param previousXs
+      X coordinates of the other circles' centers at the start of
+      the tick.
+
+    \param previousYs
+      Y coordinates of the other circles' centers at the start of
+      the tick.
+
+    \param radii
+      Radii of the other circles.
+
+    \param count
+      Number of other circles.
+
+    \param hitMask
+      Receives one bit per circle, as in CircleOverlap().
+
+    \return
+      Returns the number of hits.
+  */
+  /**************************************************************/
+  unsigned SweptCircleOverlap(float x, float y, float previousX, float previousY, float radius, const float* xs, const float* ys, const float* previousXs, const float* previousYs, const float* radii, unsigned count, uint64_t* hitMask);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Checks whether the CPU (and OS) support AVX2.
+
+    \return
+      Returns true if CircleOverlapAVX2() can be used.
+  */
+  /**************************************************************/
+  bool CpuSupportsAVX2();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // CircleOverlap_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
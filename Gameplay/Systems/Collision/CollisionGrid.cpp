@@ -0,0 +1,214 @@
+/* ======================================================================== */
+/*!
+ * \file            CollisionGrid.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A uniform grid broadphase. Circles from one or more position arrays are
+   bucketed into square cells once per tick, then circles can be queried
+   against only the cells they overlap instead of every object.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "CollisionGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Barrage
+{
+  CollisionGrid::CollisionGrid() :
+    xMin_(0.0f),
+    yMin_(0.0f),
+    inverseCellSize_(1.0f),
+    columns_(1),
+    rows_(1),
+    sources_(),
+    sourceCounts_(),
+    sourceRadii_(),
+    maxRadius_(0.0f),
+    sourceVelocityX_(),
+    sourceVelocityY_(),
+    sourceNumMoved_(),
+    hasSweptEntries_(false),
+    maxSweep_(0.0f),
+    cellStarts_(2, 0),
+    entryCells_(),
+    entries_(),
+    entryX_(),
+    entryY_(),
+    entryRadii_(),
+    entryPreviousX_(),
+    entryPreviousY_()
+  {
+  }
+
+  void CollisionGrid::Reset(float xMin, float yMin, float xMax, float yMax, float cellSize)
+  {
+    float width = std::max(xMax - xMin, 0.0f);
+    float height = std::max(yMax - yMin, 0.0f);
+
+    // keep the cell count bounded no matter how large the area or small the objects
+    cellSize = std::max(cellSize, std::max(width, height) / MAX_GRID_DIMENSION);
+
+    if (!(cellSize > 0.0f))
+    {
+      cellSize = 1.0f;
+    }
+
+    xMin_ = xMin;
+    yMin_ = yMin;
+    inverseCellSize_ = 1.0f / cellSize;
+    columns_ = std::min(static_cast<unsigned>(width * inverseCellSize_) + 1, MAX_GRID_DIMENSION);
+    rows_ = std::min(static_cast<unsigned>(height * inverseCellSize_) + 1, MAX_GRID_DIMENSION);
+
+    sources_.clear();
+    sourceCounts_.clear();
+    sourceRadii_.clear();
+    maxRadius_ = 0.0f;
+    sourceVelocityX_.clear();
+    sourceVelocityY_.clear();
+    sourceNumMoved_.clear();
+    hasSweptEntries_ = false;
+    maxSweep_ = 0.0f;
+    entries_.clear();
+  }
+
+  void CollisionGrid::AddSource(const Position* positions, unsigned count, float radius, const float* velocityX, const float* velocityY, unsigned numMoved)
+  {
+    bool swept = velocityX && velocityY;
+
+    sources_.push_back(positions);
+    sourceCounts_.push_back(count);
+    sourceRadii_.push_back(radius);
+    sourceVelocityX_.push_back(swept ? velocityX : nullptr);
+    sourceVelocityY_.push_back(swept ? velocityY : nullptr);
+    sourceNumMoved_.push_back(swept ? std::min(numMoved, count) : 0);
+    maxRadius_ = std::max(maxRadius_, radius);
+
+    if (!swept)
+    {
+      return;
+    }
+
+    float max_speed_squared = 0.0f;
+
+    for (unsigned i = 0; i < sourceNumMoved_.back(); ++i)
+    {
+      max_speed_squared = std::max(max_speed_squared, velocityX[i] * velocityX[i] + velocityY[i] * velocityY[i]);
+    }
+
+    if (max_speed_squared > 0.0f)
+    {
+      hasSweptEntries_ = true;
+      maxSweep_ = std::max(maxSweep_, std::sqrt(max_speed_squared));
+    }
+  }
+
+  void CollisionGrid::Build()
+  {
+    unsigned num_cells = columns_ * rows_;
+    unsigned num_buckets = 2 * num_cells;
+    unsigned num_entries = 0;
+    unsigned num_moving = 0;
+
+    for (unsigned source = 0; source < sources_.size(); ++source)
+    {
+      num_entries += sourceCounts_[source];
+      num_moving += hasSweptEntries_ ? sourceNumMoved_[source] : 0;
+    }
+
+    cellStarts_.assign(num_buckets + 1, 0);
+    entryCells_.resize(num_entries);
+    entries_.resize(num_entries);
+    entryX_.resize(num_entries);
+    entryY_.resize(num_entries);
+    entryRadii_.resize(num_entries);
+    entryPreviousX_.resize(num_moving);
+    entryPreviousY_.resize(num_moving);
+
+    // count objects per bucket (offset by one so the prefix sum gives each bucket's start);
+    // moving objects go in the second set of buckets, so they follow every stationary one
+    unsigned entry = 0;
+
+    for (unsigned source = 0; source < sources_.size(); ++source)
+    {
+      const Position* positions = sources_[source];
+      unsigned num_moved = hasSweptEntries_ ? sourceNumMoved_[source] : 0;
+
+      for (unsigned i = 0; i < sourceCounts_[source]; ++i, ++entry)
+      {
+        unsigned bucket = GetRow(positions[i].y_) * columns_ + GetColumn(positions[i].x_) + (i < num_moved ? num_cells : 0);
+
+        entryCells_[entry] = bucket;
+        ++cellStarts_[bucket + 1];
+      }
+    }
+
+    for (unsigned bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      cellStarts_[bucket + 1] += cellStarts_[bucket];
+    }
+
+    // scatter objects into their buckets; cellStarts_ is used as a cursor and restored below
+    unsigned num_stationary = num_entries - num_moving;
+
+    entry = 0;
+
+    for (unsigned source = 0; source < sources_.size(); ++source)
+    {
+      const Position* positions = sources_[source];
+
+      for (unsigned i = 0; i < sourceCounts_[source]; ++i, ++entry)
+      {
+        unsigned sorted_index = cellStarts_[entryCells_[entry]]++;
+
+        entries_[sorted_index] = GridEntry{ source, i };
+        entryX_[sorted_index] = positions[i].x_;
+        entryY_[sorted_index] = positions[i].y_;
+        entryRadii_[sorted_index] = sourceRadii_[source];
+
+        if (sorted_index >= num_stationary)
+        {
+          entryPreviousX_[sorted_index - num_stationary] = positions[i].x_ - sourceVelocityX_[source][i];
+          entryPreviousY_[sorted_index - num_stationary] = positions[i].y_ - sourceVelocityY_[source][i];
+        }
+      }
+    }
+
+    for (unsigned bucket = num_buckets; bucket > 0; --bucket)
+    {
+      cellStarts_[bucket] = cellStarts_[bucket - 1];
+    }
+
+    cellStarts_[0] = 0;
+  }
+
+  unsigned CollisionGrid::GetColumn(float x) const
+  {
+    float column = std::floor((x - xMin_) * inverseCellSize_);
+
+    // also catches NaN, which fails both comparisons
+    if (!(column > 0.0f))
+    {
+      return 0;
+    }
+
+    return column < columns_ ? static_cast<unsigned>(column) : columns_ - 1;
+  }
+
+  unsigned CollisionGrid::GetRow(float y) const
+  {
+    float row = std::floor((y - yMin_) * inverseCellSize_);
+
+    if (!(row > 0.0f))
+    {
+      return 0;
+    }
+
+    return row < rows_ ? static_cast<unsigned>(row) : rows_ - 1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+/* ======================================================================== */
+/*!
+ * \file            CollisionGrid.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A uniform grid broadphase. Circles from one or more position arrays are
+   bucketed into square cells once per tick, then circles can be queried
+   against only the cells they overlap instead of every object.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CollisionGrid_BARRAGE_H
+#define CollisionGrid_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Renderer/RendererTypes.hpp"
+#include "CircleOverlap.hpp"
+
+#include <vector>
+
+namespace Barrage
+{
+  constexpr unsigned MAX_GRID_DIMENSION = 256; //!< Most cells a collision grid has along either axis
+
+  //! An object stored in a collision grid
+  struct GridEntry
+  {
+    unsigned source_; //!< Which position array the object came from (in the order sources were added)
+    unsigned index_;  //!< The object's index in its position array
+  };
+
+  //! Buckets objects into a uniform grid for fast proximity queries
+  class CollisionGrid
+  {
+    public:
+      /**************************************************************/
+      /*!
+        \brief
+          Default constructor. The grid is empty until it's reset
+          and built.
+      */
+      /**************************************************************/
+      CollisionGrid();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Sets the area the grid covers and removes all sources.
+          Objects outside the area are clamped into the edge cells,
+          so they're still found by queries (just less efficiently).
+
+        \param xMin
+          Left edge of the area.
+
+        \param yMin
+          Bottom edge of the area.
+
+        \param xMax
+          Right edge of the area.
+
+        \param yMax
+          Top edge of the area.
+
+        \param cellSize
+          The desired width and height of each cell. Grows if the area
+          would need more than MAX_GRID_DIMENSION cells along an axis.
+      */
+      /**************************************************************/
+      void Reset(float xMin, float yMin, float xMax, float yMax, float cellSize);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Adds a position array whose objects should be placed in the
+          grid as circles. The array must stay valid until the grid
+          is built.
+
+        \param positions
+          The positions of the objects.
+
+        \param count
+          The number of objects.
+
+        \param radius
+          The radius of every object in the array.
+
+        \param velocityX
+          If not null, the objects are swept: each one moved by its
+          velocity this tick, and queries test the whole path.
+
+        \param velocityY
+          Y components of the velocities (null if velocityX is).
+
+        \param numMoved
+          How many objects (from the start of the array) moved this
+          tick. The rest are treated as stationary. Ignored if the
+          source isn't swept.
+      */
+      /**************************************************************/
+      void AddSource(const Position* positions, unsigned count, float radius, const float* velocityX = nullptr, const float* velocityY = nullptr, unsigned numMoved = 0);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Places every object from every source into its cell. Also
+          copies the objects' positions and radii into per-cell
+          streams so queries can test whole cells with SIMD.
+
+          Objects that moved this tick are kept apart from the ones
+          that didn't, in a second set of cells. That way a query
+          only reaches further and pays for the swept test on the
+          objects that actually moved.
+      */
+      /**************************************************************/
+      void Build();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Calls a function on every object whose circle overlaps the
+          given circle (touching counts). Objects are visited in a
+          fixed order: objects that didn't move this tick, then those
+          that did, each by cell, then by source, then by index.
+
+          Only the cells within reach of the circle (its radius plus
+          the largest radius in the grid) are tested. Each row of
+          those cells is contiguous in the grid, so it goes through
+          CircleOverlap() as one run.
+
+          If the grid holds swept objects, this is the same as
+          QuerySwept() with a circle that didn't move.
+
+        \param x
+          X coordinate of the circle's center.
+
+        \param y
+          Y coordinate of the circle's center.
+
+        \param radius
+          Radius of the circle.
+
+        \param function
+          Called as function(const GridEntry&) for each object.
+      */
+      /**************************************************************/
+      template <typename F>
+      void Query(float x, float y, float radius, F&& function) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Like Query(), but the circle moved from a previous position
+          this tick, and both it and any swept objects in the grid
+          are tested along their whole paths (see
+          SweptCircleOverlap()).
+
+          Objects that didn't move are tested with the plain overlap
+          kernels unless the circle moved, and with no extra reach.
+
+        \param x
+          X coordinate of the circle's current center.
+
+        \param y
+          Y coordinate of the circle's current center.
+
+        \param previousX
+          X coordinate of the circle's center at the start of the tick.
+
+        \param previousY
+          Y coordinate of the circle's center at the start of the tick.
+
+        \param radius
+          Radius of the circle.
+
+        \param function
+          Called as function(const GridEntry&) for each object.
+      */
+      /**************************************************************/
+      template <typename F>
+      void QuerySwept(float x, float y, float previousX, float previousY, float radius, F&& function) const;
+
+    private:
+      /**************************************************************/
+      /*!
+        \brief
+          Runs a query on one set of cells: either the objects that
+          didn't move this tick or the ones that did. The circle's
+          parameters are the same as QuerySwept()'s.
+
+        \param moving
+          If true, tests the objects that moved this tick.
+
+        \param swept
+          If true, tests with SweptCircleOverlap(), otherwise with
+          CircleOverlap().
+
+        \param reach
+          How far from the circle's path an object's cell can be and
+          still hold a hit.
+
+        \param function
+          Called as function(const GridEntry&) for each object.
+      */
+      /**************************************************************/
+      template <typename F>
+      void QueryBuckets(bool moving, bool swept, float x, float y, float previousX, float previousY, float radius, float reach, F& function) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the column a coordinate falls in, clamped to the grid.
+      */
+      /**************************************************************/
+      unsigned GetColumn(float x) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the row a coordinate falls in, clamped to the grid.
+      */
+      /**************************************************************/
+      unsigned GetRow(float y) const;
+
+    private:
+      float xMin_;                                //!< Left edge of the grid
+      float yMin_;                                //!< Bottom edge of the grid
+      float inverseCellSize_;                     //!< One over the width of a cell
+      unsigned columns_;                          //!< Number of cells along the x axis
+      unsigned rows_;                             //!< Number of cells along the y axis
+      std::vector<const Position*> sources_;      //!< Position arrays placed in the grid
+      std::vector<unsigned> sourceCounts_;        //!< Number of objects in each position array
+      std::vector<float> sourceRadii_;            //!< Radius of the objects in each position array
+      float maxRadius_;                           //!< Largest radius in sourceRadii_
+      std::vector<const float*> sourceVelocityX_; //!< X velocities of each swept position array (null if not swept)
+      std::vector<const float*> sourceVelocityY_; //!< Y velocities of each swept position array (null if not swept)
+      std::vector<unsigned> sourceNumMoved_;      //!< Number of objects in each position array that moved this tick
+      bool hasSweptEntries_;                      //!< If true, some object in the grid moved this tick
+      float maxSweep_;                            //!< Farthest any object in the grid moved this tick
+      std::vector<unsigned> cellStarts_;          //!< Where each cell's objects begin in entries_, stationary cells then moving cells (one extra at the end)
+      std::vector<unsigned> entryCells_;          //!< Cell of each object (offset by the cell count if it moved), in source order (scratch for Build())
+      std::vector<GridEntry> entries_;            //!< All objects, stationary then moving, each sorted by cell
+      std::vector<float> entryX_;                 //!< X coordinate of each object in entries_
+      std::vector<float> entryY_;                 //!< Y coordinate of each object in entries_
+      std::vector<float> entryRadii_;             //!< Radius of each object in entries_
+      std::vector<float> entryPreviousX_;         //!< X coordinate of each moving object at the start of the tick (in entries_ order)
+      std::vector<float> entryPreviousY_;         //!< Y coordinate of each moving object at the start of the tick (in entries_ order)
+  };
+}
+
+#include "CollisionGrid.tpp"
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // CollisionGrid_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,103 @@
+/* ======================================================================== */
+/*!
+ * \file            CollisionGrid.tpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   A uniform grid broadphase. Circles from one or more position arrays are
+   bucketed into square cells once per tick, then circles can be queried
+   against only the cells they overlap instead of every object.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CollisionGrid_BARRAGE_T
+#define CollisionGrid_BARRAGE_T
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Utilities/Utilities.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Barrage
+{
+  template <typename F>
+  void CollisionGrid::Query(float x, float y, float radius, F&& function) const
+  {
+    QuerySwept(x, y, x, y, radius, std::forward<F>(function));
+  }
+
+  template <typename F>
+  void CollisionGrid::QuerySwept(float x, float y, float previousX, float previousY, float radius, F&& function) const
+  {
+    if (entries_.empty())
+    {
+      return;
+    }
+
+    bool moved = x != previousX || y != previousY;
+
+    // stationary objects are where they were all tick, so only the circle's own path needs covering
+    QueryBuckets(false, moved, x, y, previousX, previousY, radius, radius + maxRadius_, function);
+
+    // moving objects are bucketed by where they ended up, so reach back as far as any of them travelled
+    if (hasSweptEntries_)
+    {
+      QueryBuckets(true, true, x, y, previousX, previousY, radius, radius + maxRadius_ + maxSweep_, function);
+    }
+  }
+
+  template <typename F>
+  void CollisionGrid::QueryBuckets(bool moving, bool swept, float x, float y, float previousX, float previousY, float radius, float reach, F& function) const
+  {
+    unsigned column_begin = GetColumn(std::min(x, previousX) - reach);
+    unsigned column_end = GetColumn(std::max(x, previousX) + reach);
+    unsigned row_begin = GetRow(std::min(y, previousY) - reach);
+    unsigned row_end = GetRow(std::max(y, previousY) + reach);
+
+    // moving objects' buckets come after the stationary ones, and only they have previous positions
+    unsigned first_bucket = moving ? columns_ * rows_ : 0;
+    unsigned num_stationary = cellStarts_[columns_ * rows_];
+    const float* previous_xs = moving ? entryPreviousX_.data() : entryX_.data();
+    const float* previous_ys = moving ? entryPreviousY_.data() : entryY_.data();
+    unsigned previous_offset = moving ? num_stationary : 0;
+
+    uint64_t hit_mask[QUERY_RUN_SIZE / HIT_MASK_BITS];
+
+    for (unsigned row = row_begin; row <= row_end; ++row)
+    {
+      unsigned run_begin = cellStarts_[first_bucket + row * columns_ + column_begin];
+      unsigned run_end = cellStarts_[first_bucket + row * columns_ + column_end + 1];
+
+      for (unsigned begin = run_begin; begin < run_end; begin += QUERY_RUN_SIZE)
+      {
+        unsigned count = std::min(run_end - begin, QUERY_RUN_SIZE);
+        unsigned previous_begin = begin - previous_offset;
+
+        unsigned num_hits = swept ?
+          SweptCircleOverlap(x, y, previousX, previousY, radius, entryX_.data() + begin, entryY_.data() + begin, previous_xs + previous_begin, previous_ys + previous_begin, entryRadii_.data() + begin, count, hit_mask) :
+          CircleOverlap(x, y, radius, entryX_.data() + begin, entryY_.data() + begin, entryRadii_.data() + begin, count, hit_mask);
+
+        if (num_hits == 0)
+        {
+          continue;
+        }
+
+        for (unsigned word = 0; word < (count + HIT_MASK_BITS - 1) / HIT_MASK_BITS; ++word)
+        {
+          for (uint64_t bits = hit_mask[word]; bits; bits &= bits - 1)
+          {
+            function(entries_[begin + word * HIT_MASK_BITS + CountTrailingZeros(bits)]);
+          }
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // CollisionGrid_BARRAGE_T
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
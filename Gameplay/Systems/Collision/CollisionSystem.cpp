@@ -12,24 +12,42 @@
 
 #include "stdafx.h"
 #include "CollisionSystem.hpp"
+#include "OutOfBounds.hpp"
 
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Destructible/DestructibleArray.hpp"
+#include "ComponentArrays/Velocity/VelocityArray.hpp"
 
 #include "Components/BoundaryBox/BoundaryBox.hpp"
 #include "Components/CircleCollider/CircleCollider.hpp"
+#include "Components/CollisionLayer/CollisionLayer.hpp"
 #include "Components/Player/Player.hpp"
 
 #include "Spaces/Space.hpp"
 
+#include <algorithm>
+#include <cfloat>
+
 namespace Barrage
 {
   static const std::string CIRCLE_BULLET_POOLS("Circle Bullet Pools");
   static const std::string BOUNDED_BULLET_POOLS("Bounded Bullet Pools");
   static const std::string CIRCLE_PLAYER_POOLS("Circle Player Pools");
+  static const std::string CIRCLE_COLLIDER_POOLS("Circle Collider Pools");
+
+  static const unsigned CULL_RUN_SIZE = 256;
+
+  static_assert(CULL_RUN_SIZE % 64 == 0, "cull runs must start on Destructible word boundaries");
+
+  static const unsigned PLAYER_LAYER = 0;
+  static const unsigned BULLET_LAYER = 1;
   
   CollisionSystem::CollisionSystem() :
-    System()
+    System(),
+    colliders_(),
+    layerGrids_(MAX_COLLISION_LAYERS),
+    layerColliders_(MAX_COLLISION_LAYERS),
+    contactBuffers_()
   {
     PoolType circle_bullet_type;
     circle_bullet_type.AddComponent("CircleCollider");
@@ -50,89 +68,419 @@ namespace Barrage
     circle_player_type.AddComponentArray("Position");
     circle_player_type.AddComponent("Player");
     poolTypes_[CIRCLE_PLAYER_POOLS] = circle_player_type;
+
+    PoolType circle_collider_type;
+    circle_collider_type.AddComponent("CircleCollider");
+    circle_collider_type.AddComponentArray("Position");
+    poolTypes_[CIRCLE_COLLIDER_POOLS] = circle_collider_type;
+
+    PoolAccess circle_bullet_access;
+    circle_bullet_access.ReadComponent("CircleCollider");
+    circle_bullet_access.ReadComponentArray("Position");
+    circle_bullet_access.WriteComponentArray("Destructible");
+    poolAccess_[CIRCLE_BULLET_POOLS] = circle_bullet_access;
+
+    PoolAccess bounded_bullet_access;
+    bounded_bullet_access.ReadComponentArray("Position");
+    bounded_bullet_access.ReadComponent("BoundaryBox");
+    bounded_bullet_access.WriteComponentArray("Destructible");
+    poolAccess_[BOUNDED_BULLET_POOLS] = bounded_bullet_access;
+
+    PoolAccess circle_player_access;
+    circle_player_access.ReadComponent("CircleCollider");
+    circle_player_access.ReadComponentArray("Position");
+    circle_player_access.WriteComponent("Player");
+    poolAccess_[CIRCLE_PLAYER_POOLS] = circle_player_access;
+
+    PoolAccess circle_collider_access;
+    circle_collider_access.ReadComponent("CircleCollider");
+    circle_collider_access.ReadComponent("CollisionLayer");
+    circle_collider_access.ReadComponent("BoundaryBox");
+    circle_collider_access.ReadComponentArray("Position");
+    circle_collider_access.ReadComponentArray("Velocity");
+    poolAccess_[CIRCLE_COLLIDER_POOLS] = circle_collider_access;
   }
 
   void CollisionSystem::Update()
   {
-    UpdatePoolGroup(BOUNDED_BULLET_POOLS, UpdateBoundedBullets);
-    UpdateInteraction(CIRCLE_PLAYER_POOLS, CIRCLE_BULLET_POOLS, UpdatePlayerBulletCollisions);
+    UpdatePoolGroupParallel(BOUNDED_BULLET_POOLS, UpdateBoundedBullets);
+    UpdateContacts();
+    ApplyPlayerBulletContacts();
     UpdateInteraction(CIRCLE_PLAYER_POOLS, CIRCLE_BULLET_POOLS, ClearBulletsOnPlayerHit);
     UpdatePoolGroup(CIRCLE_PLAYER_POOLS, ResetPlayerHit);
   }
 
-  void CollisionSystem::UpdateBoundedBullets(Space& space, Pool& pool)
+  void CollisionSystem::UpdateBoundedBullets(Space& space, Pool& pool, unsigned begin, unsigned end)
   {
-    PositionArray& position_array = pool.GetComponentArray<Position>("Position");
-    DestructibleArray& destructible_array = pool.GetComponentArray<Destructible>("Destructible");
+    const Position* positions = pool.GetComponentArray<Position>().GetRaw();
+    DestructibleArray& destructible_array = pool.GetComponentArray<Destructible>();
 
-    BoundaryBox& boundary_box = pool.GetComponent<BoundaryBox>("BoundaryBox").Data();
+    BoundaryBox& boundary_box = pool.GetComponent<BoundaryBox>().Data();
 
-    unsigned num_bullets = pool.ActiveObjectCount();
+    uint64_t out_mask[CULL_RUN_SIZE / 64];
 
-    for (unsigned i = 0; i < num_bullets; ++i)
+    // ranges and runs both start on multiples of 64, so parallel jobs never share a Destructible word
+    for (unsigned run_begin = begin; run_begin < end; run_begin += CULL_RUN_SIZE)
     {
-      Position& pos = position_array.Data(i);
+      unsigned count = std::min(end - run_begin, CULL_RUN_SIZE);
 
-      if (pos.x_ < boundary_box.xMin_ || pos.x_ > boundary_box.xMax_ || pos.y_ < boundary_box.yMin_ || pos.y_ > boundary_box.yMax_)
+      if (OutOfBoundsMask(positions + run_begin, count, boundary_box.xMin_, boundary_box.yMin_, boundary_box.xMax_, boundary_box.yMax_, out_mask))
       {
-        destructible_array.Data(i).destroyed_ = true;
+        destructible_array.DestroyMasked(run_begin, out_mask, count);
       }
     }
   }
 
-  void CollisionSystem::UpdatePlayerBulletCollisions(Space& space, Pool& player_pool, Pool& bullet_pool)
+  const std::vector<ContactBuffer>& CollisionSystem::GetContactBuffers() const
+  {
+    return contactBuffers_;
+  }
+
+  const ContactBuffer* CollisionSystem::GetContactBuffer(Pool* poolA, Pool* poolB) const
+  {
+    unsigned num_colliders = static_cast<unsigned>(colliders_.size());
+    unsigned index_a = GetColliderIndex(poolA);
+    unsigned index_b = GetColliderIndex(poolB);
+
+    if (index_a == num_colliders || index_b == num_colliders)
+    {
+      return nullptr;
+    }
+
+    return &contactBuffers_[index_a * num_colliders + index_b];
+  }
+
+  void CollisionSystem::Subscribe(Space& space, Pool* pool)
   {
-    Player& player = player_pool.GetComponent<Player>("Player").Data();
-    
-    CircleCollider& player_collider = player_pool.GetComponent<CircleCollider>("CircleCollider").Data();
-    CircleCollider& bullet_collider = bullet_pool.GetComponent<CircleCollider>("CircleCollider").Data();
+    System::Subscribe(space, pool);
+
+    if (!poolTypes_[CIRCLE_COLLIDER_POOLS].MatchesPool(pool))
+    {
+      return;
+    }
+
+    Collider collider = {};
 
-    PositionArray& player_positions = player_pool.GetComponentArray<Position>("Position");
-    PositionArray& bullet_positions = bullet_pool.GetComponentArray<Position>("Position");
+    collider.pool_ = pool;
+    collider.hasCollisionLayer_ = pool->HasComponent<CollisionLayer>();
+    collider.hasBoundaryBox_ = pool->HasComponent<BoundaryBox>();
+    collider.hasVelocity_ = pool->HasComponentArray<Velocity>();
 
-    DestructibleArray& bullet_destructibles = bullet_pool.GetComponentArray<Destructible>("Destructible");
+    if (pool->HasComponent<Player>())
+    {
+      // pools without a collision layer keep the old player-vs-bullet behavior
+      collider.defaultLayer_ = PLAYER_LAYER;
+      collider.defaultMask_ = 1u << BULLET_LAYER;
+    }
+    else if (pool->HasTag("Bullet"))
+    {
+      collider.defaultLayer_ = BULLET_LAYER;
+      collider.defaultMask_ = 0;
+    }
+    else
+    {
+      collider.defaultLayer_ = PLAYER_LAYER;
+      collider.defaultMask_ = 0;
+    }
 
-    float collision_radius = player_collider.radius_ + bullet_collider.radius_;
+    colliders_.push_back(collider);
+    RebuildContactBuffers();
+  }
 
-    unsigned num_players = player_pool.ActiveObjectCount();
-    unsigned num_bullets = bullet_pool.ActiveObjectCount();
+  void CollisionSystem::Unsubscribe(Space& space, Pool* pool)
+  {
+    size_t num_colliders = colliders_.size();
 
-    for (unsigned i = 0; i < num_players; ++i)
+    for (auto it = colliders_.begin(); it != colliders_.end(); /* iterator incremented in body */)
     {
-      for (unsigned j = 0; j < num_bullets; ++j)
+      if (it->pool_ == pool)
+      {
+        it = colliders_.erase(it);
+      }
+      else
       {
-        float delta_x = player_positions.Data(i).x_ - bullet_positions.Data(j).x_;
-        float delta_y = player_positions.Data(i).y_ - bullet_positions.Data(j).y_;
+        ++it;
+      }
+    }
+
+    if (colliders_.size() != num_colliders)
+    {
+      RebuildContactBuffers();
+    }
+
+    System::Unsubscribe(space, pool);
+  }
 
-        if (delta_x * delta_x + delta_y * delta_y <= collision_radius * collision_radius)
+  void CollisionSystem::GatherColliders()
+  {
+    for (auto it = colliders_.begin(); it != colliders_.end(); ++it)
+    {
+      Collider& collider = *it;
+      Pool* pool = collider.pool_;
+
+      collider.positions_ = pool->GetComponentArray<Position>().GetRaw();
+      collider.velocityX_ = nullptr;
+      collider.velocityY_ = nullptr;
+      collider.count_ = pool->ActiveObjectCount();
+      collider.numMoved_ = 0;
+
+      CircleCollider& circle_collider = pool->GetComponent<CircleCollider>().Data();
+
+      collider.radius_ = circle_collider.radius_;
+
+      if (circle_collider.swept_ && collider.hasVelocity_)
+      {
+        VelocityArray& velocity_array = pool->GetComponentArray<Velocity>();
+
+        collider.velocityX_ = velocity_array.GetField(VelocityFields::VX);
+        collider.velocityY_ = velocity_array.GetField(VelocityFields::VY);
+
+        // objects spawned this tick sit at the end of the pool and haven't moved yet
+        collider.numMoved_ = collider.count_ - std::min(pool->numSpawnedObjects_, collider.count_);
+      }
+
+      if (collider.hasCollisionLayer_)
+      {
+        CollisionLayer& collision_layer = pool->GetComponent<CollisionLayer>().Data();
+
+        collider.layer_ = collision_layer.layer_ % MAX_COLLISION_LAYERS;
+        collider.mask_ = collision_layer.mask_;
+      }
+      else
+      {
+        collider.layer_ = collider.defaultLayer_;
+        collider.mask_ = collider.defaultMask_;
+      }
+    }
+  }
+
+  void CollisionSystem::BuildLayerGrid(unsigned layer)
+  {
+    CollisionGrid& grid = layerGrids_[layer];
+    std::vector<unsigned>& layer_colliders = layerColliders_[layer];
+
+    float x_min = FLT_MAX;
+    float y_min = FLT_MAX;
+    float x_max = -FLT_MAX;
+    float y_max = -FLT_MAX;
+    float max_radius = 0.0f;
+
+    layer_colliders.clear();
+
+    for (auto it = colliders_.begin(); it != colliders_.end(); ++it)
+    {
+      if (it->layer_ != layer)
+      {
+        continue;
+      }
+
+      Pool& pool = *it->pool_;
+
+      layer_colliders.push_back(static_cast<unsigned>(it - colliders_.begin()));
+      max_radius = std::max(max_radius, it->radius_);
+
+      if (it->hasBoundaryBox_)
+      {
+        BoundaryBox& boundary_box = pool.GetComponent<BoundaryBox>().Data();
+
+        x_min = std::min(x_min, boundary_box.xMin_);
+        y_min = std::min(y_min, boundary_box.yMin_);
+        x_max = std::max(x_max, boundary_box.xMax_);
+        y_max = std::max(y_max, boundary_box.yMax_);
+      }
+      else
+      {
+        for (unsigned i = 0; i < it->count_; ++i)
         {
-          player.playerHit_ = true;
-          bullet_destructibles.Data(j).destroyed_ = true;
+          x_min = std::min(x_min, it->positions_[i].x_);
+          y_min = std::min(y_min, it->positions_[i].y_);
+          x_max = std::max(x_max, it->positions_[i].x_);
+          y_max = std::max(y_max, it->positions_[i].y_);
         }
       }
     }
+
+    if (x_min > x_max || y_min > y_max)
+    {
+      x_min = x_max = y_min = y_max = 0.0f;
+    }
+
+    // cells about one collision wide keep each query to a handful of cells
+    grid.Reset(x_min, y_min, x_max, y_max, 4.0f * max_radius);
+
+    for (auto it = colliders_.begin(); it != colliders_.end(); ++it)
+    {
+      if (it->layer_ == layer)
+      {
+        grid.AddSource(it->positions_, it->count_, it->radius_, it->velocityX_, it->velocityY_, it->numMoved_);
+      }
+    }
+
+    grid.Build();
   }
 
-  void CollisionSystem::ClearBulletsOnPlayerHit(Space& space, Pool& player_pool, Pool& bullet_pool)
+  void CollisionSystem::UpdateContacts()
   {
-    Player& player = player_pool.GetComponent<Player>("Player").Data();
+    unsigned target_layers = 0;
 
-    if (player.playerHit_ && !player.isInvincible_)
+    for (auto it = contactBuffers_.begin(); it != contactBuffers_.end(); ++it)
+    {
+      it->contacts_.clear();
+    }
+
+    GatherColliders();
+
+    for (auto it = colliders_.begin(); it != colliders_.end(); ++it)
+    {
+      target_layers |= it->mask_;
+    }
+
+    // only layers something tests against need a grid
+    for (unsigned layer = 0; layer < MAX_COLLISION_LAYERS; ++layer)
+    {
+      if (target_layers & (1u << layer))
+      {
+        BuildLayerGrid(layer);
+      }
+    }
+
+    unsigned num_colliders = static_cast<unsigned>(colliders_.size());
+
+    for (unsigned collider_index = 0; collider_index < num_colliders; ++collider_index)
+    {
+      const Collider& collider = colliders_[collider_index];
+
+      // this collider's row of the buffer table
+      ContactBuffer* buffers = contactBuffers_.data() + collider_index * num_colliders;
+
+      for (unsigned layer = 0; layer < MAX_COLLISION_LAYERS; ++layer)
+      {
+        if ((collider.mask_ & (1u << layer)) == 0 || layerColliders_[layer].empty())
+        {
+          continue;
+        }
+
+        const std::vector<unsigned>& layer_colliders = layerColliders_[layer];
+
+        for (unsigned i = 0; i < collider.count_; ++i)
+        {
+          const Position& position = collider.positions_[i];
+
+          float previous_x = position.x_;
+          float previous_y = position.y_;
+
+          if (i < collider.numMoved_)
+          {
+            previous_x -= collider.velocityX_[i];
+            previous_y -= collider.velocityY_[i];
+          }
+
+          layerGrids_[layer].QuerySwept(position.x_, position.y_, previous_x, previous_y, collider.radius_, [&](const GridEntry& entry)
+            {
+              // a pool that tests against its own layer shouldn't report objects hitting themselves
+              if (layer_colliders[entry.source_] == collider_index && entry.index_ == i)
+              {
+                return;
+              }
+
+              buffers[layer_colliders[entry.source_]].contacts_.push_back(Contact{ i, entry.index_ });
+            }
+          );
+        }
+      }
+    }
+  }
+
+  void CollisionSystem::RebuildContactBuffers()
+  {
+    std::vector<ContactBuffer> old_buffers;
+    unsigned num_colliders = static_cast<unsigned>(colliders_.size());
+
+    old_buffers.swap(contactBuffers_);
+    contactBuffers_.reserve(num_colliders * num_colliders);
+
+    for (auto it = colliders_.begin(); it != colliders_.end(); ++it)
+    {
+      for (auto jt = colliders_.begin(); jt != colliders_.end(); ++jt)
+      {
+        contactBuffers_.push_back(ContactBuffer{ it->pool_, jt->pool_, std::vector<Contact>() });
+      }
+    }
+
+    // contacts stay valid until the next update, even if a pool subscribes in between
+    for (auto it = old_buffers.begin(); it != old_buffers.end(); ++it)
     {
-      DestructibleArray& bullet_destructibles = bullet_pool.GetComponentArray<Destructible>("Destructible");
+      unsigned index_a = GetColliderIndex(it->poolA_);
+      unsigned index_b = GetColliderIndex(it->poolB_);
 
-      unsigned num_bullets = bullet_pool.ActiveObjectCount();
+      if (index_a != num_colliders && index_b != num_colliders)
+      {
+        contactBuffers_[index_a * num_colliders + index_b].contacts_.swap(it->contacts_);
+      }
+    }
+  }
 
-      for (unsigned i = 0; i < num_bullets; ++i)
+  unsigned CollisionSystem::GetColliderIndex(Pool* pool) const
+  {
+    for (unsigned i = 0; i < colliders_.size(); ++i)
+    {
+      if (colliders_[i].pool_ == pool)
       {
-        bullet_destructibles.Data(i).destroyed_ = true;
+        return i;
       }
     }
+
+    return static_cast<unsigned>(colliders_.size());
+  }
+
+  void CollisionSystem::ApplyPlayerBulletContacts()
+  {
+    std::vector<Pool*>& player_pools = poolGroups_[CIRCLE_PLAYER_POOLS];
+    std::vector<Pool*>& bullet_pools = poolGroups_[CIRCLE_BULLET_POOLS];
+
+    for (auto it = contactBuffers_.begin(); it != contactBuffers_.end(); ++it)
+    {
+      if (it->contacts_.empty())
+      {
+        continue;
+      }
+
+      bool player_vs_bullet =
+        std::find(player_pools.begin(), player_pools.end(), it->poolA_) != player_pools.end() &&
+        std::find(bullet_pools.begin(), bullet_pools.end(), it->poolB_) != bullet_pools.end();
+
+      if (!player_vs_bullet)
+      {
+        continue;
+      }
+
+      Player& player = it->poolA_->GetComponent<Player>().Data();
+      DestructibleArray& bullet_destructibles = it->poolB_->GetComponentArray<Destructible>();
+
+      player.playerHit_ = true;
+
+      for (auto jt = it->contacts_.begin(); jt != it->contacts_.end(); ++jt)
+      {
+        bullet_destructibles.Destroy(jt->indexB_);
+      }
+    }
+  }
+
+  void CollisionSystem::ClearBulletsOnPlayerHit(Space& space, Pool& player_pool, Pool& bullet_pool)
+  {
+    Player& player = player_pool.GetComponent<Player>().Data();
+
+    if (player.playerHit_ && !player.isInvincible_)
+    {
+      DestructibleArray& bullet_destructibles = bullet_pool.GetComponentArray<Destructible>();
+
+      bullet_destructibles.DestroyRange(0, bullet_pool.ActiveObjectCount());
+    }
   }
 
   void CollisionSystem::ResetPlayerHit(Space& space, Pool& pool)
   {
-    Player& player = pool.GetComponent<Player>("Player").Data();
+    Player& player = pool.GetComponent<Player>().Data();
 
     player.playerHit_ = false;
   }
@@ -16,10 +16,26 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Objects/Systems/System.hpp"
+#include "CollisionGrid.hpp"
 
 namespace Barrage
 {
-  //! <class description>
+  //! A collision between object A of one pool and object B of another (or the same) pool
+  struct Contact
+  {
+    unsigned indexA_; //!< Index of the object in pool A
+    unsigned indexB_; //!< Index of the object in pool B
+  };
+
+  //! All contacts found this tick between objects of pool A and objects of pool B
+  struct ContactBuffer
+  {
+    Pool* poolA_;                    //!< The pool whose collision mask includes pool B's layer
+    Pool* poolB_;                    //!< The pool being tested against
+    std::vector<Contact> contacts_;  //!< Contacts, ordered by A's object index (kept allocated between ticks)
+  };
+
+  //! Finds collisions between pools on interacting collision layers and responds to them
   class CollisionSystem : public System
   {
     public:
@@ -34,20 +50,173 @@ namespace Barrage
       /**************************************************************/
       /*!
         \brief
-          Iterates through each collider bucket and handles collisions
-          against pools in the other buckets.
+          Subscribes a pool to the system. Collider pools get an entry
+          in the collider list here, with their layer rules worked
+          out once from the components and tags they have, and a
+          contact buffer for each pairing with the other colliders.
+      */
+      /**************************************************************/
+      void Subscribe(Space& space, Pool* pool) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Unsubscribes a pool from the system and drops its collider
+          entry and any contact buffers that refer to it.
+      */
+      /**************************************************************/
+      void Unsubscribe(Space& space, Pool* pool) override;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Tests every collider pool against the layers in its
+          collision mask, fills the contact buffers, then applies the
+          built-in responses (player hits and bullet clearing).
       */
       /**************************************************************/
       void Update() override;
 
+      /**************************************************************/
+      /*!
+        \brief
+          Gets every contact buffer. Each ordered pair of collider
+          pools has a buffer from the time both are subscribed, so
+          a pair that isn't tested against each other (or didn't
+          touch this tick) has an empty buffer.
+
+          Contacts stay valid from the end of this system's update to
+          the start of its next one. Systems that consume them should
+          update after this one and touch the same pools in a
+          conflicting way so the scheduler orders them after it.
+
+        \return
+          Returns the contact buffers.
+      */
+      /**************************************************************/
+      const std::vector<ContactBuffer>& GetContactBuffers() const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Gets the contacts found between two pools.
+
+        \param poolA
+          The pool doing the testing (its mask includes B's layer).
+
+        \param poolB
+          The pool being tested against.
+
+        \return
+          Returns the pair's contact buffer, or nullptr if either pool
+          isn't a subscribed collider pool.
+      */
+      /**************************************************************/
+      const ContactBuffer* GetContactBuffer(Pool* poolA, Pool* poolB) const;
+
     private:
-      static void UpdateBoundedBullets(Space& space, Pool& pool);
-      
-      static void UpdatePlayerBulletCollisions(Space& space, Pool& player_pool, Pool& bullet_pool);
+      //! A collider pool and its data for the current tick
+      struct Collider
+      {
+        Pool* pool_;                //!< The pool
+        bool hasCollisionLayer_;    //!< True if the pool's layer and mask come from its CollisionLayer
+        bool hasBoundaryBox_;       //!< True if the pool's BoundaryBox bounds its objects
+        bool hasVelocity_;          //!< True if the pool has velocities to sweep its colliders with
+        unsigned defaultLayer_;     //!< The pool's layer if it has no CollisionLayer
+        unsigned defaultMask_;      //!< The pool's mask if it has no CollisionLayer
+        const Position* positions_; //!< The pool's positions
+        const float* velocityX_;    //!< X velocities if the pool's colliders are swept (null otherwise)
+        const float* velocityY_;    //!< Y velocities if the pool's colliders are swept (null otherwise)
+        unsigned count_;            //!< Number of active objects in the pool
+        unsigned numMoved_;         //!< Number of objects that moved this tick (the rest were just spawned)
+        float radius_;              //!< Collider radius of every object in the pool
+        unsigned layer_;            //!< The layer the pool is on
+        unsigned mask_;             //!< The layers the pool tests against
+      };
+
+      static void UpdateBoundedBullets(Space& space, Pool& pool, unsigned begin, unsigned end);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Reads the layer, mask, and positions of every collider pool.
+          Pools without a CollisionLayer component use the layer and
+          mask chosen when they subscribed. Swept colliders
+          also get their velocities, so their positions at the start
+          of the tick can be worked out.
+      */
+      /**************************************************************/
+      void GatherColliders();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Rebuilds the broadphase grid for a layer from the positions
+          of the collider pools on it, and records which colliders
+          went into it. The grid covers the union of
+          those pools' boundary boxes (or their objects' extents, for
+          pools without one).
+
+        \param layer
+          The layer to build the grid for.
+      */
+      /**************************************************************/
+      void BuildLayerGrid(unsigned layer);
+
+      /**************************************************************/
+      /*!
+        \brief
+          Clears the contact buffers, then tests each collider pool
+          against the grid of every layer in its mask.
+      */
+      /**************************************************************/
+      void UpdateContacts();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Remakes the contact buffers after the collider list changes.
+          Buffers are laid out as a square table, one row per testing
+          collider and one column per tested collider, so UpdateContacts
+          can find a pair's buffer without searching. Pairs that
+          already had a buffer keep their contacts.
+      */
+      /**************************************************************/
+      void RebuildContactBuffers();
+
+      /**************************************************************/
+      /*!
+        \brief
+          Finds a pool in the collider list.
+
+        \param pool
+          The pool to find.
+
+        \return
+          Returns the pool's index in the collider list, or the size of
+          the list if the pool isn't a collider pool.
+      */
+      /**************************************************************/
+      unsigned GetColliderIndex(Pool* pool) const;
+
+      /**************************************************************/
+      /*!
+        \brief
+          Flags players that touched a bullet as hit and destroys the
+          bullets they touched.
+      */
+      /**************************************************************/
+      void ApplyPlayerBulletContacts();
 
       static void ClearBulletsOnPlayerHit(Space& space, Pool& player_pool, Pool& bullet_pool);
 
       static void ResetPlayerHit(Space& space, Pool& pool);
+
+    private:
+      std::vector<Collider> colliders_;              //!< Subscribed collider pools, refreshed each tick
+      std::vector<CollisionGrid> layerGrids_;        //!< Broadphase grid for each layer
+      std::vector<std::vector<unsigned>> layerColliders_; //!< Colliders in each layer's grid, in grid source order
+      std::vector<ContactBuffer> contactBuffers_;         //!< Contacts for each ordered pair of colliders (see RebuildContactBuffers)
   };
 }
 
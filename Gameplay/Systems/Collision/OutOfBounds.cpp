@@ -0,0 +1,97 @@
+/* ======================================================================== */
+/*!
+ * \file            OutOfBounds.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Kernels that test a run of positions against a box and report the ones
+   outside it as a bitmask, ready to be merged into a DestructibleArray.
+   The SSE2 version gives exactly the same results as the scalar one.
+ */
+/* ======================================================================== */
+
+#include "stdafx.h"
+#include "OutOfBounds.hpp"
+#include "Utilities/Utilities.hpp"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BARRAGE_X64
+#include <immintrin.h>
+#endif
+
+namespace Barrage
+{
+  namespace
+  {
+    // tests positions [begin, count) one at a time
+    unsigned OutOfBoundsTail(const Position* positions, unsigned begin, unsigned count, float xMin, float yMin, float xMax, float yMax, uint64_t* outMask)
+    {
+      unsigned numOut = 0;
+
+      for (unsigned i = begin; i < count; ++i)
+      {
+        const Position& pos = positions[i];
+
+        if (pos.x_ < xMin || pos.x_ > xMax || pos.y_ < yMin || pos.y_ > yMax)
+        {
+          outMask[i / 64] |= uint64_t(1) << (i % 64);
+          ++numOut;
+        }
+      }
+
+      return numOut;
+    }
+  }
+
+  unsigned OutOfBoundsMask(const Position* positions, unsigned count, float xMin, float yMin, float xMax, float yMax, uint64_t* outMask)
+  {
+#ifdef BARRAGE_X64
+    std::memset(outMask, 0, (count + 63) / 64 * sizeof(uint64_t));
+
+    // positions are stored x, y, x, y, so one register holds two positions and the box is laid out to match
+    const __m128 lower = _mm_setr_ps(xMin, yMin, xMin, yMin);
+    const __m128 upper = _mm_setr_ps(xMax, yMax, xMax, yMax);
+
+    static_assert(sizeof(Position) == 2 * sizeof(float), "positions must be tightly packed x, y pairs");
+
+    const float* coordinates = reinterpret_cast<const float*>(positions);
+
+    unsigned numOut = 0;
+    unsigned i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 first = _mm_loadu_ps(coordinates + 2 * i);
+      __m128 second = _mm_loadu_ps(coordinates + 2 * i + 4);
+
+      __m128 firstOut = _mm_or_ps(_mm_cmplt_ps(first, lower), _mm_cmpgt_ps(first, upper));
+      __m128 secondOut = _mm_or_ps(_mm_cmplt_ps(second, lower), _mm_cmpgt_ps(second, upper));
+
+      // fold each position's x and y results together: lanes become (p0, p1, p2, p3)
+      __m128 xOut = _mm_shuffle_ps(firstOut, secondOut, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 yOut = _mm_shuffle_ps(firstOut, secondOut, _MM_SHUFFLE(3, 1, 3, 1));
+
+      unsigned bits = static_cast<unsigned>(_mm_movemask_ps(_mm_or_ps(xOut, yOut)));
+
+      // groups of four never straddle a mask word since 64 is a multiple of four
+      outMask[i / 64] |= uint64_t(bits) << (i % 64);
+      numOut += CountSetBits(bits);
+    }
+
+    return numOut + OutOfBoundsTail(positions, i, count, xMin, yMin, xMax, yMax, outMask);
+#else
+    return OutOfBoundsMaskScalar(positions, count, xMin, yMin, xMax, yMax, outMask);
+#endif
+  }
+
+  unsigned OutOfBoundsMaskScalar(const Position* positions, unsigned count, float xMin, float yMin, float xMax, float yMax, uint64_t* outMask)
+  {
+    std::memset(outMask, 0, (count + 63) / 64 * sizeof(uint64_t));
+
+    return OutOfBoundsTail(positions, 0, count, xMin, yMin, xMax, yMax, outMask);
+  }
+}
\ No newline at end of file
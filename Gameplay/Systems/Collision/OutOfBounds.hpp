@@ -0,0 +1,75 @@
+/* ======================================================================== */
+/*!
+ * \file            OutOfBounds.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   Kernels that test a run of positions against a box and report the ones
+   outside it as a bitmask, ready to be merged into a DestructibleArray.
+   The SSE2 version gives exactly the same results as the scalar one.
+ */
+/* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef OutOfBounds_BARRAGE_H
+#define OutOfBounds_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Renderer/RendererTypes.hpp"
+
+#include <cstdint>
+
+namespace Barrage
+{
+  /**************************************************************/
+  /*!
+    \brief
+      Tests a run of positions against a box. Position i is out of
+      bounds if it's strictly left, right, below, or above the box
+      (positions on the edge are inside, and so are NaNs).
+
+      Uses SSE2 where it's available.
+
+    \param positions
+      The positions to test.
+
+    \param count
+      Number of positions.
+
+    \param xMin
+      Left edge of the box.
+
+    \param yMin
+      Bottom edge of the box.
+
+    \param xMax
+      Right edge of the box.
+
+    \param yMax
+      Top edge of the box.
+
+    \param outMask
+      Receives one bit per position (bit i % 64 of word i / 64). Must
+      hold at least (count + 63) / 64 words. Bits past count are
+      cleared.
+
+    \return
+      Returns the number of positions out of bounds.
+  */
+  /**************************************************************/
+  unsigned OutOfBoundsMask(const Position* positions, unsigned count, float xMin, float yMin, float xMax, float yMax, uint64_t* outMask);
+
+  /**************************************************************/
+  /*!
+    \brief
+      Reference version of OutOfBoundsMask() without SIMD.
+  */
+  /**************************************************************/
+  unsigned OutOfBoundsMaskScalar(const Position* positions, unsigned count, float xMin, float yMin, float xMax, float yMax, uint64_t* outMask);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // OutOfBounds_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
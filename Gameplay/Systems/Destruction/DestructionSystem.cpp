@@ -28,6 +28,10 @@ namespace Barrage
     PoolType destructible_type;
     destructible_type.AddComponentArray("Destructible");
     poolTypes_[DESTRUCTIBLE_POOLS] = destructible_type;
+
+    PoolAccess destructible_access;
+    destructible_access.WriteAll();
+    poolAccess_[DESTRUCTIBLE_POOLS] = destructible_access;
   }
   
   void DestructionSystem::Update()
@@ -37,47 +41,46 @@ namespace Barrage
 
   void DestructionSystem::DestroyObjects(Space& space, Pool& pool)
   {
-    DestructibleArray& destructibleArray = pool.GetComponentArray<Destructible>("Destructible");
-    Destructible* destructiblesRaw = destructibleArray.GetRaw();
+    DestructibleArray& destructibleArray = pool.GetComponentArray<Destructible>();
+    const uint64_t* destroyedBits = destructibleArray.GetBits();
     unsigned numActiveObjects = pool.ActiveObjectCount();
-    unsigned deadBeginIndex = GetFirstDeadObjectIndex(destructibleArray, numActiveObjects);
+    unsigned deadBeginIndex = destructibleArray.FindFirstDestroyed(numActiveObjects);
 
     // if no objects were destroyed, early out
     if (deadBeginIndex >= numActiveObjects)
       return;
 
-    for (auto it = pool.components_.begin(); it != pool.components_.end(); ++it)
+    // scan the destruction bits once; every array and component replays the same moves
+    DestructionPlan& plan = pool.destructionPlan_;
+
+    if (pool.unorderedDestruction_)
     {
-      it->second->HandleDestructions(destructiblesRaw, deadBeginIndex, numActiveObjects);
+      plan.BuildUnordered(destroyedBits, deadBeginIndex, numActiveObjects);
     }
-
-    for (auto it = pool.componentArrays_.begin(); it != pool.componentArrays_.end(); ++it)
+    else
     {
-      // we'll operate on the destructible array last; after the loop finishes
-      if (it->first == "Destructible")
-        continue;
-
-      it->second->HandleDestructions(destructiblesRaw, deadBeginIndex, numActiveObjects);
+      plan.Build(destroyedBits, deadBeginIndex, numActiveObjects);
     }
 
-    // operate on the destructibles array last and update the number of alive objects in the pool
-    pool.numActiveObjects_ = destructibleArray.HandleDestructions(destructibleArray.GetRaw(), deadBeginIndex, numActiveObjects);
-  }
-
-  unsigned DestructionSystem::GetFirstDeadObjectIndex(DestructibleArray& destructiblesArray, unsigned numElements)
-  {
-    unsigned index = 0;
+    for (auto it = pool.components_.begin(); it != pool.components_.end(); ++it)
+    {
+      if (*it)
+      {
+        (*it)->HandleDestructions(plan);
+      }
+    }
 
-    while (index < numElements)
+    for (auto it = pool.componentArrays_.begin(); it != pool.componentArrays_.end(); ++it)
     {
-      if (destructiblesArray.Data(index).destroyed_ == true)
+      if (*it)
       {
-        break;
+        (*it)->HandleDestructions(plan);
       }
-        
-      ++index;
     }
 
-    return index;
+    pool.numActiveObjects_ = plan.numAliveObjects_;
+
+    // compaction may have moved the newest objects away from the end of the pool
+    pool.numSpawnedObjects_ = 0;
   }
 }
\ No newline at end of file
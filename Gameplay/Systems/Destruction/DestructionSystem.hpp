@@ -47,33 +47,15 @@ namespace Barrage
       /*!
         \brief
           Destroys all objects marked for destruction in a pool, 
-          retaining the relative order between alive objects. Indices 
-          for alive objects may be changed.
+          retaining the relative order between alive objects unless
+          the pool uses unordered destruction. Indices for alive
+          objects may be changed.
 
         \param pool
           The pool to update.
       */
       /**************************************************************/
       static void DestroyObjects(Space& space, Pool& pool);
-
-      /**************************************************************/
-      /*!
-        \brief
-          Gets the index of the first dead object in the input array
-          (or one past the end of the array if none exist).
-
-        \param destructiblesArray
-          The array to check for dead objects.
-
-        \param numElements
-          The number of elements to check.
-
-        \return
-          Returns the index of the first dead object in the input array
-          (or one past the end of the array if none exist).
-      */
-      /**************************************************************/
-      static unsigned GetFirstDeadObjectIndex(DestructibleArray& destructiblesArray, unsigned numElements);
 	};
 }
 
@@ -46,6 +46,12 @@ namespace Barrage
     animated_pool_type.AddComponent("Animation");
     animated_pool_type.AddComponent("Sprite");
     poolTypes_[ANIMATED_POOLS] = animated_pool_type;
+
+    PoolAccess animated_pool_access;
+    animated_pool_access.WriteComponentArray("TextureUV");
+    animated_pool_access.WriteComponent("Animation");
+    animated_pool_access.ReadComponent("Sprite");
+    poolAccess_[ANIMATED_POOLS] = animated_pool_access;
   }
   
   void DrawSystem::Subscribe(Space& space, Pool* pool)
@@ -54,7 +60,7 @@ namespace Barrage
     
     if (poolTypes_[BASIC_2D_SPRITE_POOLS].MatchesPool(pool))
     {
-      Sprite& pool_sprite = pool->GetComponent<Sprite>("Sprite").Data();
+      Sprite& pool_sprite = pool->GetComponent<Sprite>().Data();
       
       drawPools_[pool_sprite.layer_].push_back(pool);
 
@@ -63,8 +69,8 @@ namespace Barrage
 
     if (poolTypes_[ANIMATED_POOLS].MatchesPool(pool))
     {
-      Animation& pool_animation = pool->GetComponent<Animation>("Animation").Data();
-      Sprite& pool_sprite = pool->GetComponent<Sprite>("Sprite").Data();
+      Animation& pool_animation = pool->GetComponent<Animation>().Data();
+      Sprite& pool_sprite = pool->GetComponent<Sprite>().Data();
       std::vector<AnimationSequence>& animation_sequences = pool_animation.animationSequences_;
 
       if (pool_sprite.cols_ == 0)
@@ -143,7 +149,7 @@ namespace Barrage
 
   void DrawSystem::Update()
   {
-    UpdatePoolGroup(ANIMATED_POOLS, UpdateAnimations);
+    UpdatePoolGroupParallel(ANIMATED_POOLS, UpdateAnimations);
   }
 
   void DrawSystem::Draw()
@@ -158,13 +164,16 @@ namespace Barrage
       {
         Pool* pool = *jt;
 
-        PositionArray& position_array = pool->GetComponentArray<Position>("Position");
-        ScaleArray& scale_array = pool->GetComponentArray<Scale>("Scale");
-        RotationArray& rotation_array = pool->GetComponentArray<Rotation>("Rotation");
-        ColorTintArray& color_tint_array = pool->GetComponentArray<ColorTint>("ColorTint");
-        TextureUVArray& texture_uv_array = pool->GetComponentArray<TextureUV>("TextureUV");
+        PositionArray& position_array = pool->GetComponentArray<Position>();
+        ScaleArray& scale_array = pool->GetComponentArray<Scale>();
+        RotationArray& rotation_array = pool->GetComponentArray<Rotation>();
+        ColorTintArray& color_tint_array = pool->GetComponentArray<ColorTint>();
+        TextureUVArray& texture_uv_array = pool->GetComponentArray<TextureUV>();
+
+        Sprite& pool_sprite = pool->GetComponent<Sprite>().Data();
 
-        Sprite& pool_sprite = pool->GetComponent<Sprite>("Sprite").Data();
+        // pools can grow while spawning, so instance buffers may need to grow with them
+        renderer.ReserveInstances(pool->GetCapacity());
 
         renderer.DrawInstanced(
           position_array.GetRaw(),
@@ -179,14 +188,12 @@ namespace Barrage
     }
   }
 
-  void DrawSystem::UpdateAnimations(Space& space, Pool& pool)
+  void DrawSystem::UpdateAnimations(Space& space, Pool& pool, unsigned begin, unsigned end)
   {
-    Animation& pool_animation = pool.GetComponent<Animation>("Animation").Data();
-    TextureUVArray& texture_uv_array = pool.GetComponentArray<TextureUV>("TextureUV");
-
-    unsigned num_objects = pool.ActiveObjectCount();
+    Animation& pool_animation = pool.GetComponent<Animation>().Data();
+    TextureUVArray& texture_uv_array = pool.GetComponentArray<TextureUV>();
 
-    for (unsigned i = 0; i < num_objects; ++i)
+    for (unsigned i = begin; i < end; ++i)
     {
       AnimationState& animation_state = pool_animation.animationStates_.Data(i);
       AnimationSequence& animation_sequence = pool_animation.animationSequences_.at(animation_state.animationSequenceIndex_);
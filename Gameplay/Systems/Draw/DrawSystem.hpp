@@ -70,7 +70,7 @@ namespace Barrage
       void Draw();
 
     private:
-      static void UpdateAnimations(Space& space, Pool& pool);
+      static void UpdateAnimations(Space& space, Pool& pool, unsigned begin, unsigned end);
       
       DrawPoolMap drawPools_;
   };
@@ -27,21 +27,24 @@ namespace Barrage
     basic_lifetime_type.AddComponentArray("Lifetime");
     basic_lifetime_type.AddComponentArray("Destructible");
     poolTypes_[BASIC_LIFETIME_POOLS] = basic_lifetime_type;
+
+    PoolAccess basic_lifetime_access;
+    basic_lifetime_access.WriteComponentArray("Lifetime");
+    basic_lifetime_access.WriteComponentArray("Destructible");
+    poolAccess_[BASIC_LIFETIME_POOLS] = basic_lifetime_access;
   }
 
   void LifetimeSystem::Update()
   {
-    UpdatePoolGroup(BASIC_LIFETIME_POOLS, UpdateLifetimes);
+    UpdatePoolGroupParallel(BASIC_LIFETIME_POOLS, UpdateLifetimes);
   }
 
-  void LifetimeSystem::UpdateLifetimes(Space& space, Pool& pool)
+  void LifetimeSystem::UpdateLifetimes(Space& space, Pool& pool, unsigned begin, unsigned end)
   {
-    LifetimeArray& lifetime_array = pool.GetComponentArray<Lifetime>("Lifetime");
-    DestructibleArray& destructible_array = pool.GetComponentArray<Destructible>("Destructible");
-
-    unsigned num_objects = pool.ActiveObjectCount();
+    LifetimeArray& lifetime_array = pool.GetComponentArray<Lifetime>();
+    DestructibleArray& destructible_array = pool.GetComponentArray<Destructible>();
 
-    for (unsigned i = 0; i < num_objects; ++i)
+    for (unsigned i = begin; i < end; ++i)
     {
       Lifetime& lifetime = lifetime_array.Data(i);
 
@@ -49,7 +52,7 @@ namespace Barrage
 
       if (lifetime.ticks_ <= 0)
       {
-        destructible_array.Data(i).destroyed_ = true;
+        destructible_array.Destroy(i);
       }
     }
   }
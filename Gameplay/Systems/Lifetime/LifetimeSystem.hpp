@@ -40,7 +40,7 @@ namespace Barrage
       void Update() override;
 
     private:
-      static void UpdateLifetimes(Space& space, Pool& pool);
+      static void UpdateLifetimes(Space& space, Pool& pool, unsigned begin, unsigned end);
   };
 }
 
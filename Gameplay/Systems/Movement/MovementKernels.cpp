@@ -0,0 +1,89 @@
+/* ======================================================================== */
+/*!
+ * \file            MovementKernels.cpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The per-object movement math MovementSystem runs on pools. It's kept
+   apart from the system so it can also be run on bare arrays (the
+   determinism check replays it at several optimization levels).
+ */
+ /* ======================================================================== */
+
+#include "stdafx.h"
+#include "MovementKernels.hpp"
+#include "Math/Batch/BatchMath.hpp"
+
+namespace Barrage
+{
+  namespace
+  {
+    // moves objects [begin, end), first applying any acceleration and turning to their velocities
+    template <bool ACCELERATES, bool TURNS>
+    void MoveObjects(Position* positions, VelocityArray& velocityArray, const Acceleration* accelerations, const TurnRate* turnRates, unsigned begin, unsigned end)
+    {
+      float* vx = velocityArray.GetField(VelocityFields::VX);
+      float* vy = velocityArray.GetField(VelocityFields::VY);
+      float* speed = velocityArray.GetField(VelocityFields::SPEED);
+      float* dir_x = velocityArray.GetField(VelocityFields::DIR_X);
+      float* dir_y = velocityArray.GetField(VelocityFields::DIR_Y);
+
+      for (unsigned i = begin; i < end; ++i)
+      {
+        if (TURNS)
+        {
+          float sin_turn;
+          float cos_turn;
+
+          SinCos(turnRates[i].w_.value_, sin_turn, cos_turn);
+
+          float x = dir_x[i] * cos_turn - dir_y[i] * sin_turn;
+          float y = dir_x[i] * sin_turn + dir_y[i] * cos_turn;
+          float correction = 1.5f - 0.5f * (x * x + y * y);
+
+          dir_x[i] = x * correction;
+          dir_y[i] = y * correction;
+        }
+
+        if (ACCELERATES)
+        {
+          float new_speed = speed[i] + accelerations[i].a_;
+
+          speed[i] = new_speed > 0.0f ? new_speed : 0.0f;
+        }
+
+        if (ACCELERATES || TURNS)
+        {
+          vx[i] = speed[i] * dir_x[i];
+          vy[i] = speed[i] * dir_y[i];
+        }
+
+        positions[i].x_ += vx[i];
+        positions[i].y_ += vy[i];
+      }
+    }
+  }
+
+  void MoveObjects(Position* positions, VelocityArray& velocityArray, const Acceleration* accelerations, const TurnRate* turnRates, unsigned begin, unsigned end)
+  {
+    // one pass per object whatever the pool has; the template drops the steps it doesn't need
+    if (accelerations && turnRates)
+    {
+      MoveObjects<true, true>(positions, velocityArray, accelerations, turnRates, begin, end);
+    }
+    else if (accelerations)
+    {
+      MoveObjects<true, false>(positions, velocityArray, accelerations, turnRates, begin, end);
+    }
+    else if (turnRates)
+    {
+      MoveObjects<false, true>(positions, velocityArray, accelerations, turnRates, begin, end);
+    }
+    else
+    {
+      MoveObjects<false, false>(positions, velocityArray, accelerations, turnRates, begin, end);
+    }
+  }
+}
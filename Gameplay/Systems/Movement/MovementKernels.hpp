@@ -0,0 +1,57 @@
+/* ======================================================================== */
+/*!
+ * \file            MovementKernels.hpp
+ * \par             Barrage Engine
+ * \author          David Cruse
+ * \par             david.n.cruse\@gmail.com
+
+ * \brief
+   The per-object movement math MovementSystem runs on pools. It's kept
+   apart from the system so it can also be run on bare arrays (the
+   determinism check replays it at several optimization levels).
+ */
+ /* ======================================================================== */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef MovementKernels_BARRAGE_H
+#define MovementKernels_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ComponentArrays/Acceleration/AccelerationArray.hpp"
+#include "ComponentArrays/Position/PositionArray.hpp"
+#include "ComponentArrays/TurnRate/TurnRateArray.hpp"
+#include "ComponentArrays/Velocity/VelocityArray.hpp"
+
+namespace Barrage
+{
+  /**************************************************************/
+  /*!
+    \brief
+      Moves a range of objects by their velocities, first applying
+      any acceleration and turning to the velocities.
+
+    \param positions
+      The objects' positions.
+
+    \param velocityArray
+      The objects' velocities.
+
+    \param accelerations
+      The objects' accelerations, or null if they don't accelerate.
+
+    \param turnRates
+      The objects' turn rates, or null if they don't turn.
+
+    \param begin
+      Index of the first object to move.
+
+    \param end
+      One past the index of the last object to move.
+  */
+  /**************************************************************/
+  void MoveObjects(Position* positions, VelocityArray& velocityArray, const Acceleration* accelerations, const TurnRate* turnRates, unsigned begin, unsigned end);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#endif // MovementKernels_BARRAGE_H
+////////////////////////////////////////////////////////////////////////////////
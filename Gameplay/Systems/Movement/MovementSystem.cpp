@@ -14,14 +14,19 @@
 #include "MovementSystem.hpp"
 #include "Engine.hpp"
 #include "Utilities/Utilities.hpp"
+#include "Math/Batch/BatchMath.hpp"
 
 #include "Components/Player/Player.hpp"
 #include "ComponentArrays/Velocity/VelocityArray.hpp"
 #include "Components/BoundaryBox/BoundaryBox.hpp"
+#include "ComponentArrays/Acceleration/AccelerationArray.hpp"
 #include "ComponentArrays/AngularSpeed/AngularSpeedArray.hpp"
+#include "ComponentArrays/CurveProgress/CurveProgressArray.hpp"
 #include "ComponentArrays/Position/PositionArray.hpp"
 #include "ComponentArrays/Rotation/RotationArray.hpp"
+#include "ComponentArrays/TurnRate/TurnRateArray.hpp"
 #include "Components/Movement/Movement.hpp"
+#include "MovementKernels.hpp"
 
 namespace Barrage
 {
@@ -29,7 +34,8 @@ namespace Barrage
   static const std::string BASIC_ROTATION_POOLS("Basic Rotation Pools");
   static const std::string PLAYER_POOLS("Player Pools");
   static const std::string BOUNDED_PLAYER_POOLS("Bounded Player Pools");
-  
+  static const std::string CURVE_MOVEMENT_POOLS("Curve Movement Pools");
+
   MovementSystem::MovementSystem() :
     System()
   {
@@ -53,19 +59,67 @@ namespace Barrage
     bounded_player_type.AddComponent("BoundaryBox");
     bounded_player_type.AddComponent("Player");
     poolTypes_[BOUNDED_PLAYER_POOLS] = bounded_player_type;
+
+    PoolType curve_movement_type;
+    curve_movement_type.AddComponentArray("Position");
+    curve_movement_type.AddComponentArray("CurveProgress");
+    curve_movement_type.AddComponent("Movement");
+    poolTypes_[CURVE_MOVEMENT_POOLS] = curve_movement_type;
+
+    PoolAccess basic_movement_access;
+    basic_movement_access.WriteComponentArray("Position");
+    basic_movement_access.WriteComponentArray("Velocity");
+    basic_movement_access.ReadComponentArray("Acceleration");
+    basic_movement_access.ReadComponentArray("TurnRate");
+    poolAccess_[BASIC_MOVEMENT_POOLS] = basic_movement_access;
+
+    PoolAccess basic_rotation_access;
+    basic_rotation_access.WriteComponentArray("Rotation");
+    basic_rotation_access.ReadComponentArray("AngularSpeed");
+    poolAccess_[BASIC_ROTATION_POOLS] = basic_rotation_access;
+
+    PoolAccess player_access;
+    player_access.WriteComponentArray("Velocity");
+    player_access.ReadComponent("Player");
+    poolAccess_[PLAYER_POOLS] = player_access;
+
+    PoolAccess bounded_player_access;
+    bounded_player_access.WriteComponentArray("Position");
+    bounded_player_access.ReadComponent("BoundaryBox");
+    bounded_player_access.ReadComponent("Player");
+    poolAccess_[BOUNDED_PLAYER_POOLS] = bounded_player_access;
+
+    PoolAccess curve_movement_access;
+    curve_movement_access.WriteComponentArray("Position");
+    curve_movement_access.WriteComponentArray("CurveProgress");
+    curve_movement_access.ReadComponent("Movement");
+    poolAccess_[CURVE_MOVEMENT_POOLS] = curve_movement_access;
+  }
+
+  void MovementSystem::Subscribe(Space& space, Pool* pool)
+  {
+    System::Subscribe(space, pool);
+
+    if (poolTypes_[CURVE_MOVEMENT_POOLS].MatchesPool(pool))
+    {
+      Movement& movement = pool->GetComponent<Movement>().Data();
+
+      movement.path_.Build(movement.curve_);
+    }
   }
 
   void MovementSystem::Update()
   {
     UpdatePoolGroup(PLAYER_POOLS, UpdatePlayerMovement);
-    UpdatePoolGroup(BASIC_MOVEMENT_POOLS, UpdateBasicMovement);
+    UpdatePoolGroupParallel(BASIC_MOVEMENT_POOLS, UpdateBasicMovement);
+    UpdatePoolGroupParallel(CURVE_MOVEMENT_POOLS, UpdateCurveMovement);
     UpdatePoolGroup(BASIC_ROTATION_POOLS, UpdateBasicRotation);
     UpdatePoolGroup(BOUNDED_PLAYER_POOLS, UpdatePlayerBounds);
   }
 
   void MovementSystem::UpdatePlayerMovement(Space& space, Pool& pool)
   {
-    Player& player = pool.GetComponent<Player>("Player").Data();
+    Player& player = pool.GetComponent<Player>().Data();
     InputManager& input = Engine::Get().Input();
 
     float speed = 0.0f;
@@ -112,20 +166,24 @@ namespace Barrage
       player_velocity.y = player_velocity.y / 1.4142f;
     }
 
-    VelocityArray& velocity_array = pool.GetComponentArray<Velocity>("Velocity");
+    VelocityArray& velocity_array = pool.GetComponentArray<Velocity>();
 
     unsigned num_objects = pool.ActiveObjectCount();
 
     for (unsigned i = 0; i < num_objects; ++i)
     {
-      velocity_array.Data(i).SetVelocity(player_velocity.x, player_velocity.y);
+      Velocity velocity = velocity_array.Get(i);
+
+      velocity.SetVelocity(player_velocity.x, player_velocity.y);
+
+      velocity_array.Set(i, velocity);
     }
   }
 
   void MovementSystem::UpdatePlayerBounds(Space& space, Pool& pool)
   {
-    PositionArray& position_array = pool.GetComponentArray<Position>("Position");
-    BoundaryBox& bounds = pool.GetComponent<BoundaryBox>("BoundaryBox").Data();
+    PositionArray& position_array = pool.GetComponentArray<Position>();
+    BoundaryBox& bounds = pool.GetComponent<BoundaryBox>().Data();
 
     unsigned num_objects = pool.ActiveObjectCount();
 
@@ -145,31 +203,48 @@ namespace Barrage
     }
   }
 
-  void MovementSystem::UpdateBasicMovement(Space& space, Pool& pool)
+  void MovementSystem::UpdateBasicMovement(Space& space, Pool& pool, unsigned begin, unsigned end)
   {
-    PositionArray& position_array = pool.GetComponentArray<Position>("Position");
-    VelocityArray& velocity_array = pool.GetComponentArray<Velocity>("Velocity");
+    Position* positions = pool.GetComponentArray<Position>().GetRaw();
+    VelocityArray& velocity_array = pool.GetComponentArray<Velocity>();
+
+    const Acceleration* accelerations = pool.HasComponentArray<Acceleration>() ? pool.GetComponentArray<Acceleration>().GetRaw() : nullptr;
+    const TurnRate* turn_rates = pool.HasComponentArray<TurnRate>() ? pool.GetComponentArray<TurnRate>().GetRaw() : nullptr;
+
+    MoveObjects(positions, velocity_array, accelerations, turn_rates, begin, end);
+  }
+
+  void MovementSystem::UpdateBasicRotation(Space& space, Pool& pool)
+  {
+    RotationArray& rotation_array = pool.GetComponentArray<Rotation>();
+    AngularSpeedArray& angular_speed_array = pool.GetComponentArray<AngularSpeed>();
 
     unsigned num_objects = pool.ActiveObjectCount();
 
     for (unsigned i = 0; i < num_objects; ++i)
     {
-      position_array.Data(i).x_ += velocity_array.Data(i).GetVx();
-      position_array.Data(i).y_ += velocity_array.Data(i).GetVy();
+      float& angle = rotation_array.Data(i).angle_.value_;
+
+      angle = WrapAngle(angle + angular_speed_array.Data(i).w_.value_);
     }
   }
 
-  void MovementSystem::UpdateBasicRotation(Space& space, Pool& pool)
+  void MovementSystem::UpdateCurveMovement(Space& space, Pool& pool, unsigned begin, unsigned end)
   {
-    RotationArray& rotation_array = pool.GetComponentArray<Rotation>("Rotation");
-    AngularSpeedArray& angular_speed_array = pool.GetComponentArray<AngularSpeed>("AngularSpeed");
+    PositionArray& position_array = pool.GetComponentArray<Position>();
+    CurveProgressArray& progress_array = pool.GetComponentArray<CurveProgress>();
+    const ArcLengthTable& path = pool.GetComponent<Movement>().Data().path_;
 
-    unsigned num_objects = pool.ActiveObjectCount();
+    float* distances = progress_array.GetField(CurveProgressFields::DISTANCE);
+    const float* speeds = progress_array.GetField(CurveProgressFields::SPEED);
+    float length = path.GetLength();
 
-    for (unsigned i = 0; i < num_objects; ++i)
+    // objects stop at the ends of the curve
+    for (unsigned i = begin; i < end; ++i)
     {
-      rotation_array.Data(i).angle_.value_ += angular_speed_array.Data(i).w_.value_;
-      rotation_array.Data(i).angle_.value_ = ClampWrapped(rotation_array.Data(i).angle_.value_, 0.0f, 2.0f * 3.141592f);
+      distances[i] = Clamp(distances[i] + speeds[i], 0.0f, length);
     }
+
+    path.GetPositions(distances + begin, position_array.GetRaw() + begin, end - begin);
   }
 }
\ No newline at end of file
@@ -31,6 +31,15 @@ namespace Barrage
       /**************************************************************/
       MovementSystem();
 
+      /**************************************************************/
+      /*!
+        \brief
+          Subscribes a pool to the system. Pools that follow a curve
+          get their curve baked into a distance table here.
+      */
+      /**************************************************************/
+      void Subscribe(Space& space, Pool* pool) override;
+
       /**************************************************************/
       /*!
          \brief
@@ -44,9 +53,11 @@ namespace Barrage
 
       static void UpdatePlayerBounds(Space& space, Pool& pool);
 
-      static void UpdateBasicMovement(Space& space, Pool& pool);
+      static void UpdateBasicMovement(Space& space, Pool& pool, unsigned begin, unsigned end);
 
       static void UpdateBasicRotation(Space& space, Pool& pool);
+
+      static void UpdateCurveMovement(Space& space, Pool& pool, unsigned begin, unsigned end);
   };
 }
 
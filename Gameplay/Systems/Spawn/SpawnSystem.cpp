@@ -23,6 +23,37 @@ namespace Barrage
 {
   static const std::string ALL_POOLS("All Pools");
   static const std::string SPAWNER_POOLS("Spawner Pools");
+
+  namespace
+  {
+    // gives new objects a start tick and brings the schedules up to date with the pool
+    void UpdateSchedules(Spawner& spawner, const std::vector<AutomaticSpawn>& automaticSpawns, unsigned numObjects)
+    {
+      for (unsigned i = spawner.numScheduledObjects_; i < numObjects; ++i)
+      {
+        spawner.startTicks_.Data(i) = spawner.tick_;
+      }
+
+      unsigned firstUnscheduled = spawner.numScheduledObjects_;
+
+      // an edit or a new pattern means every object is scheduled again from its start tick
+      if (spawner.rescheduleNeeded_ || spawner.scheduledPattern_ != spawner.currentPattern_ || spawner.schedules_.size() != automaticSpawns.size())
+      {
+        spawner.schedules_.clear();
+        spawner.schedules_.resize(automaticSpawns.size());
+        spawner.scheduledPattern_ = spawner.currentPattern_;
+        spawner.rescheduleNeeded_ = false;
+        firstUnscheduled = 0;
+      }
+
+      for (unsigned object = firstUnscheduled; object < numObjects; ++object)
+      {
+        spawner.ScheduleObject(automaticSpawns, object);
+      }
+
+      spawner.numScheduledObjects_ = numObjects;
+    }
+  }
   
   SpawnSystem::SpawnSystem() :
     System()
@@ -33,6 +64,15 @@ namespace Barrage
     PoolType spawner_type;
     spawner_type.AddComponent("Spawner");
     poolTypes_[SPAWNER_POOLS] = spawner_type;
+
+    // spawning writes into destination pools, which can be any pool
+    PoolAccess all_pool_access;
+    all_pool_access.WriteAll();
+    poolAccess_[ALL_POOLS] = all_pool_access;
+
+    PoolAccess spawner_access;
+    spawner_access.WriteComponent("Spawner");
+    poolAccess_[SPAWNER_POOLS] = spawner_access;
   }
 
   void SpawnSystem::Subscribe(Space& space, Pool* pool)
@@ -62,44 +102,52 @@ namespace Barrage
 
   void SpawnSystem::UpdateAutomaticSpawns(Space& space, Pool& pool)
   {
-    Spawner& spawner = pool.GetComponent<Spawner>("Spawner").Data();
+    Spawner& spawner = pool.GetComponent<Spawner>().Data();
     SpawnPattern& currentPattern = spawner.patterns_.at(spawner.currentPattern_);
     std::vector<AutomaticSpawn>& automaticSpawns = currentPattern.automaticSpawns_;
-    unsigned numObjects = pool.ActiveObjectCount();
 
-    for (auto it = automaticSpawns.begin(); it != automaticSpawns.end(); ++it)
+    UpdateSchedules(spawner, automaticSpawns, pool.ActiveObjectCount());
+
+    // only objects that fire this tick are visited
+    for (unsigned i = 0; i < automaticSpawns.size(); ++i)
     {
-      SpawnType& spawnType = spawner.spawnTypes_.at(it->spawnType_);
-      
-      for (unsigned i = 0; i < numObjects; ++i)
+      AutomaticSpawn& automaticSpawn = automaticSpawns[i];
+      std::vector<ScheduledSpawn>& schedule = spawner.schedules_[i];
+      SpawnType& spawnType = spawner.spawnTypes_.at(automaticSpawn.spawnType_);
+
+      while (!schedule.empty() && schedule.front().tick_ <= spawner.tick_)
       {
-        const unsigned currentTick = spawner.spawnTimers_.Data(i);
+        std::pop_heap(schedule.begin(), schedule.end(), FiresLater);
+
+        ScheduledSpawn& scheduledSpawn = schedule.back();
 
-        if (it->ticksPerSpawn_ && currentTick >= it->delay_ && (currentTick - it->delay_) % it->ticksPerSpawn_ == 0)
+        spawnType.CreateSpawn(scheduledSpawn.object_);
+
+        if (automaticSpawn.ticksPerSpawn_)
         {
-          spawnType.CreateSpawn(i);
+          scheduledSpawn.tick_ += automaticSpawn.ticksPerSpawn_;
+          std::push_heap(schedule.begin(), schedule.end(), FiresLater);
         }
-        else if (it->ticksPerSpawn_ == 0 && currentTick == it->delay_)
+        else
         {
-          spawnType.CreateSpawn(i);
+          schedule.pop_back();
         }
       }
 
-      Pool& destinationPool = space.Objects().pools_.at(spawnType.destinationPool_);
-      destinationPool.QueueSpawns(space, pool, spawnType);
+      if (!spawnType.sourceIndices_.empty())
+      {
+        Pool& destinationPool = space.Objects().pools_.at(spawnType.destinationPool_);
+        destinationPool.QueueSpawns(space, pool, spawnType);
+      }
     }
   }
 
   void SpawnSystem::UpdateSpawnTimers(Space& space, Pool& pool)
   {
-    Spawner& spawner = pool.GetComponent<Spawner>("Spawner").Data();
+    Spawner& spawner = pool.GetComponent<Spawner>().Data();
 
-    unsigned numObjects = pool.ActiveObjectCount();
-
-    for (unsigned i = 0; i < numObjects; ++i)
-    {
-      spawner.spawnTimers_.Data(i)++;
-    }
+    // every object's timer is measured from this one counter
+    spawner.tick_++;
   }
 
   void SpawnSystem::SpawnObjects(Space& space, Pool& pool)
@@ -110,7 +158,7 @@ namespace Barrage
   void SpawnSystem::LinkAndValidateSpawns(Space& space, Pool* pool)
   {
     ObjectManager& objectManager = space.Objects();
-    Spawner& spawner = pool->GetComponent<Spawner>("Spawner").Data();
+    Spawner& spawner = pool->GetComponent<Spawner>().Data();
 
     //
     // validate all spawn types
@@ -118,6 +166,18 @@ namespace Barrage
 
     SpawnTypeMap& spawnTypes = spawner.spawnTypes_;
 
+    // random ids come from names, so they're the same every run and on every machine
+    std::string poolName;
+
+    for (auto it = objectManager.pools_.begin(); it != objectManager.pools_.end(); ++it)
+    {
+      if (&it->second == pool)
+      {
+        poolName = it->first;
+        break;
+      }
+    }
+
     for (auto it = spawnTypes.begin(); it != spawnTypes.end(); /* iterator updated in body */)
     {
       SpawnType& spawnType = it->second;
@@ -138,6 +198,9 @@ namespace Barrage
         continue;
       }
 
+      spawnType.Compile();
+      spawnType.randomId_ = CounterRandom::Hash(poolName + "/" + it->first);
+
       ++it;
     }
 